@@ -48,16 +48,22 @@ namespace LinaVG::Examples
 
 	struct BackendData
 	{
-		BackendHandle m_vbo = 0;
-		BackendHandle m_vao = 0;
-		BackendHandle m_ebo = 0;
+		BackendHandle m_vbo			= 0;
+		BackendHandle m_vao			= 0;
+		BackendHandle m_ebo			= 0;
+		BackendHandle m_instanceVbo = 0;
+		BackendHandle m_instanceVao = 0;
 		ShaderData	  m_defaultShaderData;
 		ShaderData	  m_simpleTextShaderData;
+		ShaderData	  m_instanceShaderData;
 		float		  m_proj[4][4]			 = {0};
 		const char*	  m_defaultVtxShader	 = nullptr;
 		const char*	  m_defaultFragShader	 = nullptr;
 		const char*	  m_simpleTextFragShader = nullptr;
+		const char*	  m_instanceVtxShader	 = nullptr;
+		const char*	  m_instanceFragShader	 = nullptr;
 		bool		  m_skipDraw			 = false;
+		int			  m_attribBaseVertex	 = 0;
 	};
 
 	struct Texture
@@ -97,6 +103,7 @@ namespace LinaVG::Examples
 		};
 
 		void			StartFrame();
+		void			UploadFrame(const Array<Vertex>& vertices, const Array<Index>& indices);
 		void			DrawDefault(DrawBuffer* buf);
 		void			EndFrame();
 		void			SaveAPIState();
@@ -122,6 +129,8 @@ namespace LinaVG::Examples
 
 	private:
 		void SetScissors(const Vec4i& clip);
+		void SetVertexAttributes(int baseVertex);
+		void DrawInstances(DrawBuffer* buf);
 		void AddShaderUniforms(ShaderData& data);
 		void CreateShader(ShaderData& data, const char* vert, const char* frag);
 		void CreateFontTexture(unsigned int width, unsigned int height);
@@ -34,6 +34,9 @@ OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "glad/glad.h"
 #include "Backends/GL/GLBackend.hpp"
+
+// After GLAD
+#include "GLFW/glfw3.h"
 #include "LinaVG/Core/BufferStore.hpp"
 #include "LinaVG/Core/Drawer.hpp"
 #include "LinaVG/Core/Math.hpp"
@@ -57,6 +60,62 @@ namespace LinaVG::Examples
 	float		 GLBackend::s_debugZoom		 = 1.0f;
 	Vec2		 GLBackend::s_debugOffset	 = Vec2(0.0f, 0.0f);
 
+	// GL 3.3 instancing entry points, loaded at runtime as the bundled GLAD only covers GL 3.0.
+	typedef void(APIENTRYP VertexAttribDivisorFunc)(GLuint index, GLuint divisor);
+	typedef void(APIENTRYP DrawArraysInstancedFunc)(GLenum mode, GLint first, GLsizei count, GLsizei instanceCount);
+	static VertexAttribDivisorFunc s_vertexAttribDivisor = nullptr;
+	static DrawArraysInstancedFunc s_drawArraysInstanced = nullptr;
+
+	// VertexColor attribute, see LINAVG_VERTEX_COLOR_RGBA8.
+	static void SetColorAttribPointer(GLuint index, GLsizei stride, size_t offset)
+	{
+#ifdef LINAVG_VERTEX_COLOR_RGBA8
+		glVertexAttribPointer(index, 4, GL_UNSIGNED_BYTE, GL_TRUE, stride, (void*)offset);
+#else
+		glVertexAttribPointer(index, 4, GL_FLOAT, GL_FALSE, stride, (void*)offset);
+#endif
+	}
+
+	// Matches the Vertex layout LinaVG was built with, see LINAVG_VERTEX_COLOR_RGBA8, LINAVG_VERTEX_UV_HALF & LINAVG_VERTEX_EDGE_AA.
+	static void SetVertexAttribPointers(size_t base)
+	{
+#ifdef LINAVG_VERTEX_UV_HALF
+		const GLenum uvType = GL_HALF_FLOAT;
+#else
+		const GLenum uvType = GL_FLOAT;
+#endif
+
+		const GLsizei stride = static_cast<GLsizei>(sizeof(Vertex));
+		glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, stride, (void*)(base + offsetof(Vertex, pos)));
+		glVertexAttribPointer(1, 2, uvType, GL_FALSE, stride, (void*)(base + offsetof(Vertex, uv)));
+		SetColorAttribPointer(2, stride, base + offsetof(Vertex, col));
+
+#ifdef LINAVG_VERTEX_EDGE_AA
+		glVertexAttribPointer(3, 1, GL_FLOAT, GL_FALSE, stride, (void*)(base + offsetof(Vertex, edge)));
+		glEnableVertexAttribArray(3);
+#endif
+	}
+
+	// One ShapeInstance per instance, center & halfSize as well as rotation, thickness & outlineThickness are read as single vectors.
+	static void SetInstanceAttribPointers()
+	{
+		const GLsizei stride = static_cast<GLsizei>(sizeof(ShapeInstance));
+		glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, stride, (void*)offsetof(ShapeInstance, center));
+		glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, stride, (void*)offsetof(ShapeInstance, cornerRadii));
+		SetColorAttribPointer(2, stride, offsetof(ShapeInstance, colorStart));
+		SetColorAttribPointer(3, stride, offsetof(ShapeInstance, colorEnd));
+		glVertexAttribIPointer(4, 1, GL_INT, stride, (void*)offsetof(ShapeInstance, gradientType));
+		glVertexAttribPointer(5, 3, GL_FLOAT, GL_FALSE, stride, (void*)offsetof(ShapeInstance, rotation));
+		SetColorAttribPointer(6, stride, offsetof(ShapeInstance, outlineColor));
+		glVertexAttribPointer(7, 1, GL_FLOAT, GL_FALSE, stride, (void*)offsetof(ShapeInstance, aaThickness));
+
+		for (GLuint i = 0; i < 8; i++)
+		{
+			glEnableVertexAttribArray(i);
+			s_vertexAttribDivisor(i, 1);
+		}
+	}
+
 #define FONT_ATLAS_WIDTH  2048
 #define FONT_ATLAS_HEIGHT 2048
 
@@ -66,13 +125,16 @@ namespace LinaVG::Examples
 										   "layout (location = 0) in vec2 pos;\n"
 										   "layout (location = 1) in vec2 uv;\n"
 										   "layout (location = 2) in vec4 col;\n"
+										   "layout (location = 3) in float edge;\n"
 										   "uniform mat4 proj; \n"
 										   "out vec4 fCol;\n"
 										   "out vec2 fUV;\n"
+										   "out float fEdge;\n"
 										   "void main()\n"
 										   "{\n"
 										   "   fCol = col;\n"
 										   "   fUV = uv;\n"
+										   "   fEdge = edge;\n"
 										   "   gl_Position = proj * vec4(pos.x, pos.y, 0.0f, 1.0);\n"
 										   "}\0";
 
@@ -80,13 +142,18 @@ namespace LinaVG::Examples
 											"out vec4 fragColor;\n"
 											"in vec2 fUV;\n"
 											"in vec4 fCol;\n"
+											"in float fEdge;\n"
 											"uniform sampler2D diffuse;\n"
 											"uniform int hasTexture;\n"
 											"uniform vec4 tilingAndOffset;\n"
+											"uniform float aaWidth;\n"
 											"void main()\n"
 											"{\n"
 											"   vec4 textureColor = hasTexture != 0 ? texture(diffuse, fUV * tilingAndOffset.rg + tilingAndOffset.ba) : vec4(1.0);\n"
+											"   float edgeWidth = fwidth(fEdge) * aaWidth;\n"
+											"   float coverage = edgeWidth > 0.0 ? clamp((1.0 - abs(fEdge)) / edgeWidth + 0.5, 0.0, 1.0) : 1.0;\n"
 											"   fragColor = fCol * textureColor; \n"
+											"   fragColor.a *= coverage; \n"
 											"}\0";
 
 		m_backendData.m_simpleTextFragShader = "#version 330 core\n"
@@ -118,10 +185,85 @@ namespace LinaVG::Examples
 											   "}\n"
 											   "}\0";
 
+		// Rounded box signed distance, per ShapeInstance.
+		m_backendData.m_instanceVtxShader = "#version 330 core\n"
+											"layout (location = 0) in vec4 centerAndHalfSize;\n"
+											"layout (location = 1) in vec4 cornerRadii;\n"
+											"layout (location = 2) in vec4 colorStart;\n"
+											"layout (location = 3) in vec4 colorEnd;\n"
+											"layout (location = 4) in int gradientType;\n"
+											"layout (location = 5) in vec3 rotationAndThickness;\n"
+											"layout (location = 6) in vec4 outlineColor;\n"
+											"layout (location = 7) in float aaThickness;\n"
+											"uniform mat4 proj;\n"
+											"out vec2 fLocal;\n"
+											"flat out vec2 fHalfSize;\n"
+											"flat out vec4 fRadii;\n"
+											"flat out vec4 fColStart;\n"
+											"flat out vec4 fColEnd;\n"
+											"flat out int fGradientType;\n"
+											"flat out vec3 fThickness;\n"
+											"flat out vec4 fOutlineColor;\n"
+											"const vec2 corners[6] = vec2[6](vec2(-1.0, -1.0), vec2(1.0, -1.0), vec2(1.0, 1.0), vec2(-1.0, -1.0), vec2(1.0, 1.0), vec2(-1.0, 1.0));\n"
+											"void main()\n"
+											"{\n"
+											"   float margin = rotationAndThickness.y + rotationAndThickness.z + aaThickness + 1.0;\n"
+											"   vec2 local = corners[gl_VertexID] * (centerAndHalfSize.zw + margin);\n"
+											"   float s = sin(rotationAndThickness.x);\n"
+											"   float c = cos(rotationAndThickness.x);\n"
+											"   vec2 pos = centerAndHalfSize.xy + vec2(c * local.x - s * local.y, s * local.x + c * local.y);\n"
+											"   fLocal = local;\n"
+											"   fHalfSize = centerAndHalfSize.zw;\n"
+											"   fRadii = cornerRadii;\n"
+											"   fColStart = colorStart;\n"
+											"   fColEnd = colorEnd;\n"
+											"   fGradientType = gradientType;\n"
+											"   fThickness = vec3(rotationAndThickness.yz, aaThickness);\n"
+											"   fOutlineColor = outlineColor;\n"
+											"   gl_Position = proj * vec4(pos.x, pos.y, 0.0f, 1.0);\n"
+											"}\0";
+
+		m_backendData.m_instanceFragShader = "#version 330 core\n"
+											 "out vec4 fragColor;\n"
+											 "in vec2 fLocal;\n"
+											 "flat in vec2 fHalfSize;\n"
+											 "flat in vec4 fRadii;\n"
+											 "flat in vec4 fColStart;\n"
+											 "flat in vec4 fColEnd;\n"
+											 "flat in int fGradientType;\n"
+											 "flat in vec3 fThickness;\n"
+											 "flat in vec4 fOutlineColor;\n"
+											 "float roundBox(vec2 p, vec2 b, vec4 r)\n"
+											 "{\n"
+											 "   float rad = p.x > 0.0 ? (p.y > 0.0 ? r.z : r.y) : (p.y > 0.0 ? r.w : r.x);\n"
+											 "   vec2 q = abs(p) - b + rad;\n"
+											 "   return min(max(q.x, q.y), 0.0) + length(max(q, 0.0)) - rad;\n"
+											 "}\n"
+											 "float coverage(float d, float aa)\n"
+											 "{\n"
+											 "   return aa > 0.0 ? 1.0 - smoothstep(0.0, aa, d) : step(d, 0.0);\n"
+											 "}\n"
+											 "void main()\n"
+											 "{\n"
+											 "   float d = roundBox(fLocal, fHalfSize, fRadii);\n"
+											 "   float thickness = fThickness.x;\n"
+											 "   float outlineThickness = fThickness.y;\n"
+											 "   float shapeDist = thickness > 0.0 ? abs(d - thickness * 0.5) - thickness * 0.5 : d;\n"
+											 "   float outlineDist = abs(d - thickness - outlineThickness * 0.5) - outlineThickness * 0.5;\n"
+											 "   vec2 t = clamp(fLocal / max(fHalfSize, vec2(0.0001)) * 0.5 + 0.5, 0.0, 1.0);\n"
+											 "   vec4 fill = fGradientType == 0 ? mix(fColStart, fColEnd, t.x) : (fGradientType == 1 ? mix(fColStart, fColEnd, t.y) : fColStart);\n"
+											 "   vec4 shape = vec4(fill.rgb, fill.a * coverage(shapeDist, fThickness.z));\n"
+											 "   vec4 outline = vec4(fOutlineColor.rgb, outlineThickness > 0.0 ? fOutlineColor.a * coverage(outlineDist, fThickness.z) : 0.0);\n"
+											 "   float alpha = outline.a + shape.a * (1.0 - outline.a);\n"
+											 "   vec3 rgb = (outline.rgb * outline.a + shape.rgb * shape.a * (1.0 - outline.a)) / max(alpha, 0.0001);\n"
+											 "   fragColor = vec4(rgb, alpha);\n"
+											 "}\0";
+
 		try
 		{
 			CreateShader(m_backendData.m_defaultShaderData, m_backendData.m_defaultVtxShader, m_backendData.m_defaultFragShader);
 			CreateShader(m_backendData.m_simpleTextShaderData, m_backendData.m_defaultVtxShader, m_backendData.m_simpleTextFragShader);
+			CreateShader(m_backendData.m_instanceShaderData, m_backendData.m_instanceVtxShader, m_backendData.m_instanceFragShader);
 		}
 		catch (const std::runtime_error& err)
 		{
@@ -143,13 +285,9 @@ namespace LinaVG::Examples
 		glBindBuffer(GL_ARRAY_BUFFER, m_backendData.m_vbo);
 		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_backendData.m_ebo);
 
-		glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);
+		SetVertexAttribPointers(0);
 		glEnableVertexAttribArray(0);
-
-		glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(2 * sizeof(float)));
 		glEnableVertexAttribArray(1);
-
-		glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(4 * sizeof(float)));
 		glEnableVertexAttribArray(2);
 
 		glGenVertexArrays(1, &m_backendData.m_vao);
@@ -161,15 +299,23 @@ namespace LinaVG::Examples
 		glBindBuffer(GL_ARRAY_BUFFER, m_backendData.m_vbo);
 		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_backendData.m_ebo);
 
-		glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);
+		SetVertexAttribPointers(0);
 		glEnableVertexAttribArray(0);
-
-		glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(2 * sizeof(float)));
 		glEnableVertexAttribArray(1);
-
-		glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(4 * sizeof(float)));
 		glEnableVertexAttribArray(2);
 
+		s_vertexAttribDivisor = reinterpret_cast<VertexAttribDivisorFunc>(glfwGetProcAddress("glVertexAttribDivisor"));
+		s_drawArraysInstanced = reinterpret_cast<DrawArraysInstancedFunc>(glfwGetProcAddress("glDrawArraysInstanced"));
+
+		if (s_vertexAttribDivisor != nullptr && s_drawArraysInstanced != nullptr)
+		{
+			glGenVertexArrays(1, &m_backendData.m_instanceVao);
+			glGenBuffers(1, &m_backendData.m_instanceVbo);
+			glBindVertexArray(m_backendData.m_instanceVao);
+			glBindBuffer(GL_ARRAY_BUFFER, m_backendData.m_instanceVbo);
+			SetInstanceAttribPointers();
+		}
+
 		// note that this is allowed, the call to glVertexAttribPointer registered VBO as the vertex attribute's bound vertex buffer object so afterwards we can safely unbind
 		glBindBuffer(GL_ARRAY_BUFFER, 0);
 
@@ -255,6 +401,20 @@ namespace LinaVG::Examples
 		glBindVertexArray(m_backendData.m_vao);
 	}
 
+	void GLBackend::UploadFrame(const Array<Vertex>& vertices, const Array<Index>& indices)
+	{
+		if (m_backendData.m_skipDraw)
+			return;
+
+		glBindBuffer(GL_ARRAY_BUFFER, m_backendData.m_vbo);
+		glBufferData(GL_ARRAY_BUFFER, vertices.m_size * sizeof(Vertex), (const GLvoid*)vertices.m_data, GL_STREAM_DRAW);
+
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_backendData.m_ebo);
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.m_size * sizeof(Index), (const GLvoid*)indices.m_data, GL_STREAM_DRAW);
+
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+	}
+
 	void GLBackend::DrawDefault(DrawBuffer* buf)
 	{
 		if (m_backendData.m_skipDraw)
@@ -262,6 +422,12 @@ namespace LinaVG::Examples
 
 		SetScissors(buf->clip);
 
+		if (buf->shapeType == DrawBufferShapeType::Instanced)
+		{
+			DrawInstances(buf);
+			return;
+		}
+
 		if (buf->shapeType == DrawBufferShapeType::Text || buf->shapeType == DrawBufferShapeType::SDFText)
 		{
 			ShaderData& data = m_backendData.m_simpleTextShaderData;
@@ -303,21 +469,71 @@ namespace LinaVG::Examples
 			glUniform1i(data.m_uniformMap["diffuse"], 0);
 			glUniform1i(data.m_uniformMap["hasTexture"], buf->textureHandle != NULL_TEXTURE);
 			glUniform4f(data.m_uniformMap["tilingAndOffset"], (GLfloat)uv.x, (GLfloat)uv.y, (GLfloat)uv.z, (GLfloat)uv.w);
+			glUniform1f(data.m_uniformMap["aaWidth"], Config.globalAAMultiplier);
 		}
 
-		glBindBuffer(GL_ARRAY_BUFFER, m_backendData.m_vbo);
-		glBufferData(GL_ARRAY_BUFFER, buf->vertexBuffer.m_size * sizeof(Vertex), (const GLvoid*)buf->vertexBuffer.begin(), GL_STREAM_DRAW);
+		if (Config.frameArenaEnabled)
+		{
+			// Frame is already uploaded, re-pointing the attributes at the range start acts as a base-vertex draw on GL 3.0.
+			glBindBuffer(GL_ARRAY_BUFFER, m_backendData.m_vbo);
+			SetVertexAttributes(buf->vertexOffset);
+			glBindBuffer(GL_ARRAY_BUFFER, 0);
+			glDrawElements(GL_TRIANGLES, (GLsizei)buf->indexCount, sizeof(Index) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (const GLvoid*)(buf->indexOffset * sizeof(Index)));
+		}
+		else
+		{
+			glBindBuffer(GL_ARRAY_BUFFER, m_backendData.m_vbo);
+			SetVertexAttributes(0);
+			glBufferData(GL_ARRAY_BUFFER, buf->vertexBuffer.m_size * sizeof(Vertex), (const GLvoid*)buf->vertexBuffer.begin(), GL_STREAM_DRAW);
 
-		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_backendData.m_ebo);
-		glBufferData(GL_ELEMENT_ARRAY_BUFFER, buf->indexBuffer.m_size * sizeof(Index), (const GLvoid*)buf->indexBuffer.begin(), GL_STREAM_DRAW);
+			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_backendData.m_ebo);
+			glBufferData(GL_ELEMENT_ARRAY_BUFFER, buf->indexBuffer.m_size * sizeof(Index), (const GLvoid*)buf->indexBuffer.begin(), GL_STREAM_DRAW);
+
+			glBindBuffer(GL_ARRAY_BUFFER, 0);
+			glDrawElements(GL_TRIANGLES, (GLsizei)buf->indexBuffer.m_size, sizeof(Index) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, 0);
+		}
 
-		glBindBuffer(GL_ARRAY_BUFFER, 0);
-		glDrawElements(GL_TRIANGLES, (GLsizei)buf->indexBuffer.m_size, sizeof(Index) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, 0);
 		s_debugDrawCalls++;
 		s_debugTriCount += int((float)buf->indexBuffer.m_size / 3.0f);
 		s_debugVtxCount += buf->vertexBuffer.m_size;
 	}
 
+	void GLBackend::DrawInstances(DrawBuffer* buf)
+	{
+		if (m_backendData.m_instanceVao == 0)
+		{
+			if (Config.errorCallback)
+				Config.errorCallback("LinaVG: Instanced shapes need GL 3.3, disable Config.instancedShapesEnabled!");
+			return;
+		}
+
+		ShaderData& data = m_backendData.m_instanceShaderData;
+		glUseProgram(data.m_handle);
+		glUniformMatrix4fv(data.m_uniformMap["proj"], 1, GL_FALSE, &m_backendData.m_proj[0][0]);
+
+		// Six vertices per instance, expanded from gl_VertexID.
+		glBindVertexArray(m_backendData.m_instanceVao);
+		glBindBuffer(GL_ARRAY_BUFFER, m_backendData.m_instanceVbo);
+		glBufferData(GL_ARRAY_BUFFER, buf->instanceBuffer.m_size * sizeof(ShapeInstance), (const GLvoid*)buf->instanceBuffer.begin(), GL_STREAM_DRAW);
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+		s_drawArraysInstanced(GL_TRIANGLES, 0, 6, (GLsizei)buf->instanceBuffer.m_size);
+		glBindVertexArray(m_backendData.m_vao);
+
+		s_debugDrawCalls++;
+		s_debugTriCount += buf->instanceBuffer.m_size * 2;
+		s_debugVtxCount += buf->instanceBuffer.m_size * 6;
+	}
+
+	void GLBackend::SetVertexAttributes(int baseVertex)
+	{
+		if (m_backendData.m_attribBaseVertex == baseVertex)
+			return;
+
+		m_backendData.m_attribBaseVertex = baseVertex;
+		const size_t base				 = static_cast<size_t>(baseVertex) * sizeof(Vertex);
+		SetVertexAttribPointers(base);
+	}
+
 	void GLBackend::SetScissors(const Vec4i& clip)
 	{
 		Vec4i usedClip = clip;
@@ -78,7 +78,6 @@ namespace LinaVG
 			};
 
 			LinaVG::Config.defaultBufferReserve = 100000;
-			LinaVG::Config.gcCollectInterval	= 20000;
 			LinaVG::Config.maxFontAtlasSize		= 1024;
 
 			LinaVG::InitializeText();
@@ -90,6 +89,7 @@ namespace LinaVG
 			m_renderingBackend = new GLBackend();
 
 			m_lvgDrawer.GetCallbacks().draw			  = std::bind(&GLBackend::DrawDefault, m_renderingBackend, std::placeholders::_1);
+			m_lvgDrawer.GetCallbacks().uploadFrame	  = std::bind(&GLBackend::UploadFrame, m_renderingBackend, std::placeholders::_1, std::placeholders::_2);
 			m_lvgText.GetCallbacks().atlasNeedsUpdate = std::bind(&GLBackend::OnAtlasUpdate, m_renderingBackend, std::placeholders::_1);
 			m_demoScreens.Initialize();
 
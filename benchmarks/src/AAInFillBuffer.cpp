@@ -0,0 +1,103 @@
+/*
+This file is a part of: LinaVG
+https://github.com/inanevin/LinaVG
+
+Author: Inan Evin
+http://www.inanevin.com
+
+The 2-Clause BSD License
+
+Copyright (c) [2022-] Inan Evin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+   1. Redistributions of source code must retain the above copyright notice, this
+	  list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright notice,
+	  this list of conditions and the following disclaimer in the documentation
+	  and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+// Counts draw calls & vertices per frame of an AA heavy scene, with Config.aaInFillBufferEnabled off & on.
+
+#include "LinaVG/LinaVG.hpp"
+#include <chrono>
+#include <cstdio>
+
+using namespace LinaVG;
+
+namespace
+{
+	constexpr int FRAMES = 300;
+	constexpr int SHAPES = 400;
+
+	void Run(bool aaInFillBuffer)
+	{
+		Config.aaInFillBufferEnabled = aaInFillBuffer;
+
+		int	   drawCalls = 0;
+		int	   vertices	 = 0;
+		Drawer drawer;
+		drawer.GetCallbacks().draw = [&](DrawBuffer* buf) {
+			drawCalls++;
+			vertices += buf->vertexBuffer.m_size;
+		};
+
+		const auto start = std::chrono::steady_clock::now();
+
+		for (int frame = 0; frame < FRAMES; frame++)
+		{
+			for (int i = 0; i < SHAPES; i++)
+			{
+				StyleOptions style;
+				style.aaEnabled = true;
+				style.isFilled	= i % 3 != 0;
+
+				if (i % 5 == 0)
+					style.outlineOptions.thickness = 2.0f;
+
+				const int  drawOrder = i % 50;
+				const Vec2 pos		 = Vec2(static_cast<float>(i % 20) * 40.0f, static_cast<float>(i / 20) * 40.0f);
+
+				if (i % 2 == 0)
+					drawer.DrawRect(pos, Vec2(pos.x + 30.0f, pos.y + 20.0f), style, 0.0f, drawOrder);
+				else
+				{
+					style.rounding = 0.3f;
+					drawer.DrawRect(pos, Vec2(pos.x + 30.0f, pos.y + 20.0f), style, 0.0f, drawOrder);
+					drawer.DrawCircle(pos, 12.0f, style, 24, 0.0f, 0.0f, 360.0f, drawOrder);
+				}
+			}
+
+			drawer.FlushBuffers();
+			drawer.ResetFrame();
+		}
+
+		const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		printf("aaInFillBufferEnabled %-5s: %d draw calls/frame, %d vertices/frame, %.3f ms/frame\n", aaInFillBuffer ? "on" : "off", drawCalls / FRAMES, vertices / FRAMES, ms / FRAMES);
+	}
+} // namespace
+
+int main()
+{
+	Config.errorCallback = [](const LINAVG_STRING& err) { printf("%s\n", err.c_str()); };
+	Config.logCallback	 = [](const LINAVG_STRING& log) { printf("%s\n", log.c_str()); };
+
+	Run(false);
+	Run(true);
+	return 0;
+}
@@ -0,0 +1,108 @@
+/*
+This file is a part of: LinaVG
+https://github.com/inanevin/LinaVG
+
+Author: Inan Evin
+http://www.inanevin.com
+
+The 2-Clause BSD License
+
+Copyright (c) [2022-] Inan Evin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+   1. Redistributions of source code must retain the above copyright notice, this
+	  list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright notice,
+	  this list of conditions and the following disclaimer in the documentation
+	  and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+// Times the vertex kernels at Scalar & every SIMD level the build & CPU support, at 10k, 100k & 1M vertices.
+
+#include "LinaVG/LinaVG.hpp"
+#include "LinaVG/Core/Math.hpp"
+#include "LinaVG/Utility/Utility.hpp"
+#include <chrono>
+#include <cstdio>
+#include <random>
+
+using namespace LinaVG;
+
+namespace
+{
+	constexpr int VERTEX_COUNTS[] = {10000, 100000, 1000000};
+
+	const char* LEVEL_NAMES[] = {"Scalar", "SSE2", "AVX2", "NEON"};
+
+	// Average milliseconds per kernel call, repeated for about the same total vertices at each count.
+	template <typename Kernel> double Time(Array<Vertex>& vertices, Kernel kernel)
+	{
+		const int  repeats = Math::Max(1, 20000000 / vertices.m_size);
+		const auto start   = std::chrono::steady_clock::now();
+
+		for (int i = 0; i < repeats; i++)
+			kernel(vertices.m_data, vertices.m_size);
+
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / repeats;
+	}
+} // namespace
+
+int main()
+{
+	const Utility::SIMDLevel detected = Utility::GetSIMDLevel();
+	std::mt19937			 rng(1234);
+
+	const Vec2 bbMin = Vec2(-1000.0f, -1000.0f);
+	const Vec2 bbMax = Vec2(1000.0f, 1000.0f);
+	Vec4Grad   color = Vec4Grad(Vec4(1.0f, 0.2f, 0.3f, 1.0f), Vec4(0.1f, 0.8f, 0.5f, 1.0f));
+
+	std::printf("%-8s %-10s %12s %12s %12s %12s\n", "Level", "Vertices", "Rotate", "BBox", "UVs", "UVs&Colors");
+
+	for (int count : VERTEX_COUNTS)
+	{
+		std::uniform_real_distribution<float> pos(-1000.0f, 1000.0f);
+		Array<Vertex>						  vertices;
+		vertices.resize(count);
+
+		for (int i = 0; i < count; i++)
+		{
+			vertices[i]		= Vertex();
+			vertices[i].pos = Vec2(pos(rng), pos(rng));
+		}
+
+		for (int i = 0; i <= static_cast<int>(Utility::SIMDLevel::NEON); i++)
+		{
+			const Utility::SIMDLevel level = static_cast<Utility::SIMDLevel>(i);
+
+			Utility::SetSIMDLevel(level);
+			if (Utility::GetSIMDLevel() != level)
+				continue;
+
+			Vec2		 outMin, outMax;
+			const double rotate = Time(vertices, [](Vertex* v, int n) { Utility::RotateVertices(v, n, Vec2(0.0f, 0.0f), 0.5f); });
+			const double bbox	= Time(vertices, [&](Vertex* v, int n) { Utility::GetVerticesBoundingBox(v, n, outMin, outMax); });
+			const double uvs	= Time(vertices, [&](Vertex* v, int n) { Utility::CalculateVertexUVs(v, n, bbMin, bbMax); });
+			const double colors = Time(vertices, [&](Vertex* v, int n) { Utility::CalculateVertexUVsAndColors(v, n, bbMin, bbMax, color, false); });
+
+			std::printf("%-8s %-10d %9.3f ms %9.3f ms %9.3f ms %9.3f ms\n", LEVEL_NAMES[i], count, rotate, bbox, uvs, colors);
+		}
+	}
+
+	Utility::SetSIMDLevel(detected);
+	return 0;
+}
@@ -0,0 +1,114 @@
+/*
+This file is a part of: LinaVG
+https://github.com/inanevin/LinaVG
+
+Author: Inan Evin
+http://www.inanevin.com
+
+The 2-Clause BSD License
+
+Copyright (c) [2022-] Inan Evin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+   1. Redistributions of source code must retain the above copyright notice, this
+	  list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright notice,
+	  this list of conditions and the following disclaimer in the documentation
+	  and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#pragma once
+
+#include "Common.hpp"
+
+namespace LinaVG
+{
+	/// <summary>
+	/// Linear per-frame arena, allocations bump a pointer and are all released at once on ResetFrame.
+	/// Frame scoped, so it only backs vertex & index data, give each Drawer its own instance.
+	/// If a frame needed more than one block, the blocks are merged into a single one on ResetFrame, so a steady frame does no heap calls.
+	/// </summary>
+	class LinearAllocator : public Allocator
+	{
+	public:
+		LinearAllocator(size_t blockSize = 1024 * 1024);
+		virtual ~LinearAllocator();
+
+		LinearAllocator(const LinearAllocator&)			   = delete;
+		LinearAllocator& operator=(const LinearAllocator&) = delete;
+
+		virtual bool IsFrameScoped() const override
+		{
+			return true;
+		}
+
+	protected:
+		virtual void* DoAllocate(size_t size) override;
+		virtual void  DoFree(void* ptr, size_t size) override;
+		virtual void  DoResetFrame() override;
+		virtual void* DoReallocate(void* ptr, size_t oldSize, size_t newSize) override;
+
+	private:
+		struct Block
+		{
+			char*  data = nullptr;
+			size_t size = 0;
+			size_t used = 0;
+		};
+
+		LINAVG_VEC<Block> m_blocks;
+		size_t			  m_blockSize	 = 0;
+		size_t			  m_currentBlock = 0;
+	};
+
+	/// <summary>
+	/// Keeps freed memory in per size class free lists, power of two sizes from 16 bytes up to maxPooledSize, for reuse by later allocations.
+	/// Bigger allocations go to the heap directly. Pooled memory is only returned to the heap on Release or destruction.
+	/// </summary>
+	class PoolAllocator : public Allocator
+	{
+	public:
+		PoolAllocator(size_t maxPooledSize = 4 * 1024 * 1024);
+		virtual ~PoolAllocator();
+
+		PoolAllocator(const PoolAllocator&)			   = delete;
+		PoolAllocator& operator=(const PoolAllocator&) = delete;
+
+		/// <summary>
+		/// Returns all pooled free memory to the heap.
+		/// </summary>
+		LINAVG_API void Release();
+
+	protected:
+		virtual void* DoAllocate(size_t size) override;
+		virtual void  DoFree(void* ptr, size_t size) override;
+		virtual void* DoReallocate(void* ptr, size_t oldSize, size_t newSize) override;
+
+	private:
+		static constexpr int POOL_MIN_SHIFT	  = 4;
+		static constexpr int POOL_CLASS_COUNT = 28;
+
+		// Returns the free list a size belongs to, -1 if it's too big to pool.
+		int GetSizeClass(size_t size) const;
+
+		// Free blocks store the next free block in their first bytes.
+		void*  m_freeLists[POOL_CLASS_COUNT] = {};
+		size_t m_maxPooledSize				 = 0;
+	};
+
+} // namespace LinaVG
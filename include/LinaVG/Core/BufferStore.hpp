@@ -42,8 +42,28 @@ namespace LinaVG
 	struct TextCache
 	{
 		TextOptions	  opts;
+		LINAVG_STRING text;
 		Array<Vertex> vtxBuffer;
 		Array<Index>  indxBuffer;
+		uint64_t	  key	 = 0;
+		size_t		  bytes	 = 0;
+		Vec2		  center = Vec2(0.0f, 0.0f);
+
+		// Recency list, prev being more recently used.
+		TextCache* prev = nullptr;
+		TextCache* next = nullptr;
+	};
+
+	/// <summary>
+	/// Text cache counters, see Drawer::GetTextCacheStats. Use hits & misses to size Config.textCacheBudget.
+	/// </summary>
+	struct TextCacheStats
+	{
+		uint64_t hits	   = 0;
+		uint64_t misses	   = 0;
+		uint64_t evictions = 0;
+		size_t	 bytes	   = 0;
+		int		 entries   = 0;
 	};
 
 	struct RectOverrideData
@@ -62,30 +82,167 @@ namespace LinaVG
 		Vec2 m_uvBR		= Vec2(1, 1);
 	};
 
+	// Number of DrawBufferShapeType values, Instanced being the last one.
+	constexpr int DRAW_BUFFER_SHAPE_TYPES = static_cast<int>(DrawBufferShapeType::Instanced) + 1;
+
 	/// <summary>
 	/// Management for draw buffers.
 	/// </summary>
 	struct BufferStoreData
 	{
 		Array<DrawBuffer>				m_defaultBuffers;
-		Array<int>						m_drawOrders;
-		LINAVG_MAP<uint32_t, TextCache> m_textCache;
-		int								m_gcFrameCounter		= 0;
-		int								m_textCacheFrameCounter = 0;
+		Array<uint64_t>					m_drawCommandKeys;
+		Array<uint64_t>					m_drawCommandScratch;
+		Array<DrawBuffer*>				m_drawCommands;
+		LINAVG_VEC<DrawBuffer*>			m_mergedBuffers;
+		Array<Vertex>					m_frameVertices;
+		Array<Index>					m_frameIndices;
+		LINAVG_MAP<uint64_t, int>		m_defaultBufferLookup;
+		LINAVG_MAP<uint64_t, TextCache> m_textCache;
+		TextCache*						m_textCacheHead	 = nullptr;
+		TextCache*						m_textCacheTail	 = nullptr;
+		size_t							m_textCacheBytes = 0;
+		TextCacheStats					m_textCacheStats;
+		int								m_mergedBuffersUsed						   = 0;
+		int								m_frameVtxHighWater						   = 0;
+		int								m_frameIdxHighWater						   = 0;
+		int								m_vtxReserveHints[DRAW_BUFFER_SHAPE_TYPES] = {};
+		int								m_idxReserveHints[DRAW_BUFFER_SHAPE_TYPES] = {};
+		bool							m_lookupDirty							   = false;
 		RectOverrideData				m_rectOverrideData;
 		UVOverrideData					m_uvOverride;
-		Vec4i							m_clipRect = {0, 0, 0, 0};
+		Vec4i							m_clipRect	= {0, 0, 0, 0};
+		Allocator*						m_allocator = nullptr;
 
-		void		SetDrawOrderLimits(int drawOrder);
 		int			GetBufferIndexInDefaultArray(DrawBuffer* buf);
-		DrawBuffer& GetDefaultBuffer(void* userData, uint64_t uid, int drawOrder, DrawBufferShapeType shapeType, TextureHandle txtHandle, const Vec4& textureUV);
-		void		AddTextCache(uint32_t sid, const TextOptions& opts, DrawBuffer* buf, int vtxStart, int indexStart);
-		TextCache*	CheckTextCache(uint32_t sid, const TextOptions& opts, DrawBuffer* buf);
+		DrawBuffer& GetDefaultBuffer(void* userData, uint64_t uid, int drawOrder, DrawBufferShapeType shapeType, TextureHandle txtHandle, const Vec4& textureUV, int vertexCountHint = 0);
+
+		/// <summary>
+		/// Caches the text tessellated into buf from the given starts as the most recently used entry, evicting least recently used ones over Config.textCacheBudget.
+		/// Text is expected unrotated at the origin, center being the center its rotations are around.
+		/// </summary>
+		void AddTextCache(uint64_t key, const char* text, const TextOptions& opts, const Vec2& center, DrawBuffer* buf, int vtxStart, int indexStart);
+
+		/// <summary>
+		/// On a hit, appends the cached text to buf scaled, rotated around its center and moved by offset, see Utility::TransformText.
+		/// </summary>
+		TextCache* CheckTextCache(uint64_t key, const char* text, const TextOptions& opts, DrawBuffer* buf, const Vec2& offset, float scale, float rotateAngle);
+
+		/// <summary>
+		/// Erases all cached texts, counters are kept.
+		/// </summary>
+		void ClearTextCache();
+
+		// Recency list management.
+		void LinkTextCache(TextCache* entry);
+		void UnlinkTextCache(TextCache* entry);
+
+		/// <summary>
+		/// Hashes the batching state of a buffer, used as the key for m_defaultBufferLookup.
+		/// </summary>
+		uint64_t GetDefaultBufferHash(void* userData, uint64_t uid, int drawOrder, DrawBufferShapeType shapeType, TextureHandle txtHandle, const Vec4& textureUV, const Vec4i& clip) const;
+
+		/// <summary>
+		/// Full state comparison, guards the hashed lookup against collisions.
+		/// </summary>
+		bool IsDefaultBufferMatching(const DrawBuffer& buf, void* userData, uint64_t uid, int drawOrder, DrawBufferShapeType shapeType, TextureHandle txtHandle, const Vec4& textureUV) const;
+
+		/// <summary>
+		/// Fills m_drawCommands with all non-empty buffers of the given contexts, sorted by draw order, shape type, context order and insertion order.
+		/// </summary>
+		void BuildDrawCommands(BufferStoreData* const* contexts, int contextCount);
+
+		/// <summary>
+		/// Concatenates runs of commands whose states match into buffers of m_mergedBuffers, replacing the run in m_drawCommands.
+		/// Recorded buffers are left as they are, so their sizes & high-water marks don't include the merged geometry.
+		/// </summary>
+		void MergeDrawCommands();
+
+		/// <summary>
+		/// Next unused buffer of m_mergedBuffers for this flush, emptied & given the draw state of lead.
+		/// </summary>
+		DrawBuffer* AcquireMergedBuffer(const DrawBuffer& lead);
+
+		/// <summary>
+		/// Trims the merged buffers to their high-water marks, see Config.bufferTrimDecay.
+		/// </summary>
+		void TrimMergedBuffers();
+
+		/// <summary>
+		/// Deletes the merged buffers.
+		/// </summary>
+		void ClearMergedBuffers();
+
+		/// <summary>
+		/// Whether two buffers can be drawn with a single draw call, draw order aside.
+		/// </summary>
+		bool IsDrawStateMatching(const DrawBuffer& a, const DrawBuffer& b) const;
+
+		/// <summary>
+		/// Copies the buffers listed in m_drawCommands into the frame arenas, filling their ranges.
+		/// </summary>
+		void PackFrameArena();
+
+		/// <summary>
+		/// Points m_defaultBufferLookup at the first buffer of each state again, after buffers were removed or lookups moved to rolled over buffers.
+		/// </summary>
+		void RebuildLookup();
+
+		/// <summary>
+		/// Allocator for data living across frames, frame scoped allocators only back vertex & index data.
+		/// </summary>
+		inline Allocator* GetPersistentAllocator() const
+		{
+			return m_allocator != nullptr && !m_allocator->IsFrameScoped() ? m_allocator : nullptr;
+		}
 	};
 
 	struct BufferStoreCallbacks
 	{
 		std::function<void(DrawBuffer* buf)> draw;
+
+		/// <summary>
+		/// Only called if Config.frameArenaEnabled is set, once per FlushBuffers before any draw callbacks, with the whole frame's geometry.
+		/// </summary>
+		std::function<void(const Array<Vertex>& vertices, const Array<Index>& indices)> uploadFrame;
+	};
+
+	/// <summary>
+	/// Retained geometry, record via Drawer::BeginDrawList & Drawer::EndDrawList and replay via Drawer::ReplayDrawList.
+	/// Owns its vertices, indices and the batching state of each buffer, so static content only needs to be tessellated once.
+	/// </summary>
+	class DrawList
+	{
+	public:
+		DrawList() = default;
+		~DrawList();
+
+		DrawList(const DrawList&)			 = delete;
+		DrawList& operator=(const DrawList&) = delete;
+
+		/// <summary>
+		/// Erases all recorded geometry.
+		/// </summary>
+		LINAVG_API void Clear();
+
+		/// <summary>
+		/// Returns whether nothing was recorded.
+		/// </summary>
+		LINAVG_API bool IsEmpty() const;
+
+		inline BufferStoreData& GetData()
+		{
+			return m_data;
+		}
+
+		inline const BufferStoreData& GetData() const
+		{
+			return m_data;
+		}
+
+	private:
+		friend class Drawer;
+		BufferStoreData m_data;
 	};
 
 	class BufferStore
@@ -95,7 +252,7 @@ namespace LinaVG
 		~BufferStore();
 
 		/// <summary>
-		/// Clears up or shrinks (depending on gc interval) internal vertex/index buffers. Call each frame at the end of your draw commands, after Flushing.
+		/// Empties all buffers for the next frame, trimming their excess capacity and releasing long unused ones. Call each frame at the end of your draw commands, after Flushing.
 		/// </summary>
 		/// <returns></returns>
 		LINAVG_API void ResetFrame();
@@ -106,6 +263,15 @@ namespace LinaVG
 		/// <returns></returns>
 		LINAVG_API void FlushBuffers();
 
+		/// <summary>
+		/// Flushes this store's buffers together with the given recording contexts, e.g. one store per worker thread.
+		/// All buffers are drawn via this store's callbacks in a single order, ties in draw order and shape type are resolved by context order, this store being the first.
+		/// Recording to any of the contexts must be finished before calling this. Call ResetFrame on each context afterwards.
+		/// </summary>
+		/// <param name="contexts">Other stores to flush with, at most LINAVG_MAX_RECORDING_CONTEXTS - 1.</param>
+		/// <param name="contextCount">Number of stores in contexts.</param>
+		LINAVG_API void FlushBuffers(BufferStore* const* contexts, int contextCount);
+
 		/// <summary>
 		/// Sets the scissors/clipping data.
 		/// </summary>
@@ -117,11 +283,22 @@ namespace LinaVG
 		/// </summary>
 		LINAVG_API void ClearAllBuffers();
 
+		/// <summary>
+		/// Sets the allocator backing all buffers of this store, nullptr to use LINAVG_MALLOC & LINAVG_FREE. Clears all buffers and the text cache.
+		/// A frame scoped allocator is reset at the end of each ResetFrame.
+		/// </summary>
+		LINAVG_API void SetAllocator(Allocator* allocator);
+
 		LINAVG_API inline BufferStoreData& GetData()
 		{
 			return m_data;
 		}
 
+		inline const BufferStoreData& GetData() const
+		{
+			return m_data;
+		}
+
 		inline BufferStoreCallbacks& GetCallbacks()
 		{
 			return m_callbacks;
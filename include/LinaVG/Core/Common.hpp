@@ -42,6 +42,10 @@ OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <cassert>
 #include <cstring>
 #include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
 #include "Vectors.hpp"
 
 namespace LinaVG
@@ -53,16 +57,28 @@ namespace LinaVG
 #define LINAVG_MEMSET  std::memset
 #define LINAVG_MEMMOVE std::memmove
 #define LINAVG_MALLOC  std::malloc
+#define LINAVG_REALLOC std::realloc
 #define LINAVG_FREE	   std::free
 #define LVG_RAD2DEG	   57.2957f
 #define LVG_DEG2RAD	   0.0174533f
 #define LINAVG_API	   // TODO
 
+#ifdef LINAVG_32BIT_INDICES
+	typedef unsigned int Index;
+#define LINAVG_MAX_BUFFER_VERTICES 0x7FFFFFFF
+#else
 	typedef unsigned short Index;
+	// 0xFFFF itself is left out, it's the primitive restart index on most APIs.
+#define LINAVG_MAX_BUFFER_VERTICES 0xFFFF
+#endif
+
 	typedef unsigned int   BackendHandle;
 	typedef void*		   TextureHandle;
 	class Font;
 
+// Maximum number of BufferStores flushed together, see BufferStore::FlushBuffers.
+#define LINAVG_MAX_RECORDING_CONTEXTS 64
+
 #define NULL_TEXTURE nullptr
 
 	LINAVG_API enum class GradientType
@@ -100,6 +116,154 @@ namespace LinaVG
 
 	typedef float Thickness;
 
+	/// <summary>
+	/// Memory source for the vertex, index & bookkeeping arrays of a Drawer, BufferStore or Text, see their SetAllocator functions.
+	/// Arrays without an allocator use LINAVG_MALLOC & LINAVG_FREE directly. LinearAllocator & PoolAllocator are bundled in Allocator.hpp.
+	/// Not thread-safe, give each recording context its own instance. Must outlive everything using it.
+	/// </summary>
+	class Allocator
+	{
+	public:
+		virtual ~Allocator() = default;
+
+		/// <summary>
+		/// Returns at least size bytes, aligned to 16 bytes.
+		/// </summary>
+		inline void* Allocate(size_t size)
+		{
+			m_usedBytes += size;
+
+			if (m_usedBytes > m_peakBytes)
+				m_peakBytes = m_usedBytes;
+
+			return DoAllocate(size);
+		}
+
+		/// <summary>
+		/// Size must be the one the memory was allocated with.
+		/// </summary>
+		inline void Free(void* ptr, size_t size)
+		{
+			if (ptr == nullptr)
+				return;
+
+			m_usedBytes -= size;
+			DoFree(ptr, size);
+		}
+
+		/// <summary>
+		/// Resizes the memory, keeping its contents up to the smaller size. Allocates if ptr is nullptr.
+		/// </summary>
+		inline void* Reallocate(void* ptr, size_t oldSize, size_t newSize)
+		{
+			if (ptr == nullptr)
+				return Allocate(newSize);
+
+			m_usedBytes = m_usedBytes - oldSize + newSize;
+
+			if (m_usedBytes > m_peakBytes)
+				m_peakBytes = m_usedBytes;
+
+			return DoReallocate(ptr, oldSize, newSize);
+		}
+
+		/// <summary>
+		/// Called by the BufferStore using this allocator at the end of ResetFrame, after it stopped referencing frame scoped memory.
+		/// </summary>
+		inline void ResetFrame()
+		{
+			if (IsFrameScoped())
+				m_usedBytes = 0;
+
+			DoResetFrame();
+		}
+
+		/// <summary>
+		/// Frame scoped allocators only back vertex & index data, which is dropped without freeing on each ResetFrame.
+		/// </summary>
+		virtual bool IsFrameScoped() const
+		{
+			return false;
+		}
+
+		/// <summary>
+		/// Bytes currently handed out.
+		/// </summary>
+		inline size_t GetUsedBytes() const
+		{
+			return m_usedBytes;
+		}
+
+		/// <summary>
+		/// Highest GetUsedBytes so far.
+		/// </summary>
+		inline size_t GetPeakBytes() const
+		{
+			return m_peakBytes;
+		}
+
+		/// <summary>
+		/// Bytes currently held from the heap, including cached & unused memory.
+		/// </summary>
+		inline size_t GetReservedBytes() const
+		{
+			return m_reservedBytes;
+		}
+
+		/// <summary>
+		/// Total number of heap allocations & frees done so far, stays the same between frames once the allocator warmed up.
+		/// </summary>
+		inline uint64_t GetHeapCalls() const
+		{
+			return m_heapCalls;
+		}
+
+	protected:
+		virtual void* DoAllocate(size_t size)		 = 0;
+		virtual void  DoFree(void* ptr, size_t size) = 0;
+		virtual void  DoResetFrame() {};
+
+		// Implementations that can grow in place override this, moves to a new allocation by default.
+		virtual void* DoReallocate(void* ptr, size_t oldSize, size_t newSize)
+		{
+			void* newPtr = DoAllocate(newSize);
+
+			if (newPtr != nullptr)
+				LINAVG_MEMCPY(newPtr, ptr, oldSize < newSize ? oldSize : newSize);
+
+			DoFree(ptr, oldSize);
+			return newPtr;
+		}
+
+		// Heap access for the implementations, keeps the statistics.
+		inline void* HeapAllocate(size_t size)
+		{
+			m_heapCalls++;
+			m_reservedBytes += size;
+			return LINAVG_MALLOC(size);
+		}
+
+		inline void HeapFree(void* ptr, size_t size)
+		{
+			m_heapCalls++;
+			m_reservedBytes -= size;
+			LINAVG_FREE(ptr);
+		}
+
+		inline void* HeapReallocate(void* ptr, size_t oldSize, size_t newSize)
+		{
+			m_heapCalls++;
+			m_reservedBytes = m_reservedBytes - oldSize + newSize;
+			return LINAVG_REALLOC(ptr, newSize);
+		}
+
+	private:
+		size_t	 m_usedBytes	 = 0;
+		size_t	 m_peakBytes	 = 0;
+		size_t	 m_reservedBytes = 0;
+		uint64_t m_heapCalls	 = 0;
+	};
+
 	/// <summary>
 	/// Custom array for fast-handling vertex & index buffers for vector drawing operations.
 	/// Inspired by Dear ImGui's ImVector
@@ -109,10 +273,11 @@ namespace LinaVG
 	class Array
 	{
 	public:
-		T*						  m_data	 = nullptr;
-		int						  m_size	 = 0;
-		int						  m_lastSize = 0;
-		int						  m_capacity = 0;
+		T*						  m_data	  = nullptr;
+		int						  m_size	  = 0;
+		int						  m_lastSize  = 0;
+		int						  m_capacity  = 0;
+		Allocator*				  m_allocator = nullptr;
 		typedef T				  value_type;
 		typedef value_type*		  iterator;
 		typedef const value_type* const_iterator;
@@ -122,26 +287,52 @@ namespace LinaVG
 			m_data							 = nullptr;
 		}
 
+		/// <summary>
+		/// Copies always use LINAVG_MALLOC & LINAVG_FREE, the allocator of the source isn't shared.
+		/// </summary>
 		Array(const Array<T>& other)
 		{
-			resize(other.m_size);
-			LINAVG_MEMCPY(m_data, other.m_data, size_t(other.m_size) * sizeof(T));
+			append(other.m_data, other.m_size);
 		}
 
-		// inline Array(const Array<T>& src)
-		// {
-		//     m_size = m_capacity = m_lastSize = 0;
-		//     m_data = NULL;
-		//     operator        =(src);
-		// }
+		/// <summary>
+		/// Takes over the data & allocator of the source, leaving it empty.
+		/// </summary>
+		Array(Array<T>&& other) noexcept
+		{
+			m_data		= other.m_data;
+			m_size		= other.m_size;
+			m_lastSize	= other.m_lastSize;
+			m_capacity	= other.m_capacity;
+			m_allocator = other.m_allocator;
+			other.detach();
+		}
 
 		inline Array<T>& operator=(const Array<T>& other)
 		{
+			if (this == &other)
+				return *this;
+
+			m_size = 0;
+			append(other.m_data, other.m_size);
+			return *this;
+		}
+
+		inline Array<T>& operator=(Array<T>&& other) noexcept
+		{
+			if (this == &other)
+				return *this;
+
 			clear();
-			resize(other.m_size);
-			LINAVG_MEMCPY(m_data, other.m_data, size_t(other.m_size) * sizeof(T));
+			m_data		= other.m_data;
+			m_size		= other.m_size;
+			m_lastSize	= other.m_lastSize;
+			m_capacity	= other.m_capacity;
+			m_allocator = other.m_allocator;
+			other.detach();
 			return *this;
 		}
+
 		~Array()
 		{
 			clear();
@@ -158,12 +349,41 @@ namespace LinaVG
 		{
 			if (m_data)
 			{
+				freeData(m_data, m_capacity);
 				m_size = m_capacity = m_lastSize = 0;
-				LINAVG_FREE(m_data);
-				m_data = nullptr;
+				m_data							 = nullptr;
 			}
 		}
 
+		/// <summary>
+		/// Forgets the data without freeing it, for memory owned by a frame scoped allocator that is about to be reset.
+		/// </summary>
+		inline void detach()
+		{
+			m_size = m_capacity = m_lastSize = 0;
+			m_data							 = nullptr;
+		}
+
+		inline T* allocateData(int capacity)
+		{
+			const size_t bytes = (size_t)capacity * sizeof(T);
+			return (T*)(m_allocator != nullptr ? m_allocator->Allocate(bytes) : LINAVG_MALLOC(bytes));
+		}
+
+		inline T* reallocateData(T* data, int oldCapacity, int newCapacity)
+		{
+			const size_t bytes = (size_t)newCapacity * sizeof(T);
+			return (T*)(m_allocator != nullptr ? m_allocator->Reallocate(data, (size_t)oldCapacity * sizeof(T), bytes) : LINAVG_REALLOC(data, bytes));
+		}
+
+		inline void freeData(T* data, int capacity)
+		{
+			if (m_allocator != nullptr)
+				m_allocator->Free(data, (size_t)capacity * sizeof(T));
+			else
+				LINAVG_FREE(data);
+		}
+
 		inline bool isEmpty()
 		{
 			return m_size == 0;
@@ -215,20 +435,58 @@ namespace LinaVG
 
 		inline void reserve(int newCapacity)
 		{
-			if (newCapacity < m_capacity)
+			if (newCapacity <= m_capacity)
 				return;
-			T* newData = (T*)LINAVG_MALLOC((size_t)newCapacity * sizeof(T));
 
-			if (m_data)
+			m_data	   = relocateData(newCapacity);
+			m_capacity = newCapacity;
+		}
+
+		/// <summary>
+		/// Releases capacity above the given one, never going below the current size.
+		/// </summary>
+		inline void trim(int newCapacity)
+		{
+			if (newCapacity < m_size)
+				newCapacity = m_size;
+
+			if (newCapacity >= m_capacity)
+				return;
+
+			if (newCapacity == 0)
 			{
-				if (newData != 0)
-					LINAVG_MEMCPY(newData, m_data, (size_t)m_size * sizeof(T));
-				LINAVG_FREE(m_data);
+				freeData(m_data, m_capacity);
+				m_data = nullptr;
 			}
-			m_data	   = newData;
+			else
+				m_data = relocateData(newCapacity);
+
 			m_capacity = newCapacity;
 		}
 
+		/// <summary>
+		/// Moves the elements into an allocation of the given capacity. Trivially destructible elements are moved bitwise, which may extend the allocation in place.
+		/// Others, e.g. DrawBuffers owning arrays, are move constructed one by one.
+		/// </summary>
+		inline T* relocateData(int newCapacity)
+		{
+			if constexpr (std::is_trivially_destructible<T>::value)
+				return reallocateData(m_data, m_capacity, newCapacity);
+			else
+			{
+				T* newData = allocateData(newCapacity);
+
+				for (int i = 0; i < m_size; i++)
+				{
+					new (&newData[i]) T(std::move(m_data[i]));
+					m_data[i].~T();
+				}
+
+				freeData(m_data, m_capacity);
+				return newData;
+			}
+		}
+
 		inline void checkGrow()
 		{
 			if (m_size == m_capacity)
@@ -244,6 +502,54 @@ namespace LinaVG
 			return last();
 		}
 
+		/// <summary>
+		/// Constructs the element in place at the end.
+		/// </summary>
+		template <typename... Args> inline T* emplace_back(Args&&... args)
+		{
+			checkGrow();
+			new (&m_data[m_size]) T(std::forward<Args>(args)...);
+			m_size++;
+			return last();
+		}
+
+		/// <summary>
+		/// Copies count elements to the end with a single memcpy, returns the first of them.
+		/// </summary>
+		inline T* append(const T* src, int count)
+		{
+			if (count <= 0)
+				return m_data + m_size;
+
+			if (m_size + count > m_capacity)
+				reserve(growCapacity(m_size + count));
+
+			T* dst = m_data + m_size;
+			LINAVG_MEMCPY(dst, src, (size_t)count * sizeof(T));
+			m_size += count;
+			return dst;
+		}
+
+		/// <summary>
+		/// Appends count elements with offset added to each, e.g. indices of vertices that moved by offset.
+		/// </summary>
+		template <typename S> inline T* append_rebased(const S* src, int count, S offset)
+		{
+			if (count <= 0)
+				return m_data + m_size;
+
+			if (m_size + count > m_capacity)
+				reserve(growCapacity(m_size + count));
+
+			T* dst = m_data + m_size;
+
+			for (int i = 0; i < count; i++)
+				dst[i] = static_cast<T>(src[i] + offset);
+
+			m_size += count;
+			return dst;
+		}
+
 		inline T* erase(const T* it)
 		{
 			assert(it >= m_data && it < m_data + m_size);
@@ -428,6 +734,7 @@ namespace LinaVG
 			wrapWidth	   = opts.wrapWidth;
 			wordWrap	   = opts.wordWrap;
 			userData	   = opts.userData;
+			cpuClipping	   = opts.cpuClipping;
 			uniqueID	   = opts.uniqueID;
 		}
 
@@ -542,6 +849,7 @@ namespace LinaVG
 			isFilled			   = opts.isFilled;
 			aaEnabled			   = opts.aaEnabled;
 			userData			   = opts.userData;
+			uniqueID			   = opts.uniqueID;
 		}
 
 		/// <summary>
@@ -567,11 +875,13 @@ namespace LinaVG
 
 		/// <summary>
 		/// Enable/disable AA outlines for this shape.
+		/// With LINAVG_VERTEX_EDGE_AA, the shape's edge vertices are marked via Vertex::edge instead.
 		/// </summary>
 		bool aaEnabled = false;
 
 		/// <summary>
 		/// Antialiasing multiplier for the shapes drawn with this style options.
+		/// Not used with LINAVG_VERTEX_EDGE_AA, the AA width is up to the backend then, e.g. Config.globalAAMultiplier.
 		/// </summary>
 		float aaMultiplier = 1.0f;
 
@@ -611,11 +921,156 @@ namespace LinaVG
 		uint64_t uniqueID = 0;
 	};
 
+#ifdef LINAVG_VERTEX_COLOR_RGBA8
+	/// <summary>
+	/// Vertex color packed to 8 bits per channel, r g b a in memory order. Converts from & to Vec4 in range 0.0f - 1.0f.
+	/// </summary>
+	struct VertexColor
+	{
+		VertexColor(){};
+		VertexColor(const Vec4& v)
+			: r(Pack(v.x)), g(Pack(v.y)), b(Pack(v.z)), a(Pack(v.w)){};
+
+		operator Vec4() const
+		{
+			return Vec4(static_cast<float>(r) / 255.0f, static_cast<float>(g) / 255.0f, static_cast<float>(b) / 255.0f, static_cast<float>(a) / 255.0f);
+		}
+
+		static inline uint8_t Pack(float f)
+		{
+			return f <= 0.0f ? 0 : (f >= 1.0f ? 255 : static_cast<uint8_t>(f * 255.0f + 0.5f));
+		}
+
+		uint8_t r = 0;
+		uint8_t g = 0;
+		uint8_t b = 0;
+		uint8_t a = 0;
+	};
+#else
+	typedef Vec4 VertexColor;
+#endif
+
+#ifdef LINAVG_VERTEX_UV_HALF
+	/// <summary>
+	/// IEEE 754 half precision float, converting from & to float with round to nearest even.
+	/// </summary>
+	struct Half
+	{
+		Half(){};
+		Half(float f)
+			: bits(FromFloat(f)){};
+
+		operator float() const
+		{
+			return ToFloat(bits);
+		}
+
+		static inline uint16_t FromFloat(float f)
+		{
+			uint32_t x;
+			LINAVG_MEMCPY(&x, &f, sizeof(x));
+			const uint32_t sign = (x >> 16) & 0x8000u;
+			const uint32_t absX = x & 0x7FFFFFFFu;
+
+			// Inf & NaN.
+			if (absX >= 0x7F800000u)
+				return static_cast<uint16_t>(sign | 0x7C00u | (absX > 0x7F800000u ? 0x200u : 0u));
+
+			// Overflows to inf.
+			if (absX >= 0x477FF000u)
+				return static_cast<uint16_t>(sign | 0x7C00u);
+
+			// Subnormal or zero, shift the mantissa with its implicit bit in place & round.
+			if (absX < 0x38800000u)
+			{
+				if (absX < 0x33000000u)
+					return static_cast<uint16_t>(sign);
+
+				const uint32_t shift	= 126u - (absX >> 23);
+				const uint32_t mantissa = (absX & 0x7FFFFFu) | 0x800000u;
+				const uint32_t half		= mantissa >> shift;
+				const uint32_t rest		= mantissa & ((1u << shift) - 1u);
+				const uint32_t midpoint = 1u << (shift - 1u);
+				return static_cast<uint16_t>(sign | (half + (rest > midpoint || (rest == midpoint && (half & 1u)))));
+			}
+
+			// Normal, rebias the exponent & round, carries into the exponent are intended.
+			const uint32_t rebased = absX - 0x38000000u;
+			return static_cast<uint16_t>(sign | ((rebased + 0xFFFu + ((rebased >> 13) & 1u)) >> 13));
+		}
+
+		static inline float ToFloat(uint16_t h)
+		{
+			const uint32_t sign		= static_cast<uint32_t>(h & 0x8000u) << 16;
+			const uint32_t exponent = (h >> 10) & 0x1Fu;
+			uint32_t	   mantissa = h & 0x3FFu;
+			uint32_t	   x		= 0;
+
+			if (exponent == 0x1Fu)
+				x = sign | 0x7F800000u | (mantissa << 13);
+			else if (exponent != 0)
+				x = sign | ((exponent + 112u) << 23) | (mantissa << 13);
+			else if (mantissa != 0)
+			{
+				// Subnormal, normalize.
+				uint32_t e = 113u;
+				while ((mantissa & 0x400u) == 0)
+				{
+					mantissa <<= 1;
+					e--;
+				}
+				x = sign | (e << 23) | ((mantissa & 0x3FFu) << 13);
+			}
+			else
+				x = sign;
+
+			float f;
+			LINAVG_MEMCPY(&f, &x, sizeof(f));
+			return f;
+		}
+
+		uint16_t bits = 0;
+	};
+
+	/// <summary>
+	/// Half precision uv, converts from & to Vec2.
+	/// </summary>
+	struct VertexUV
+	{
+		VertexUV(){};
+		VertexUV(const Vec2& v)
+			: x(v.x), y(v.y){};
+
+		operator Vec2() const
+		{
+			return Vec2(x, y);
+		}
+
+		Half x;
+		Half y;
+	};
+#else
+	typedef Vec2 VertexUV;
+#endif
+
+	/// <summary>
+	/// Layout is chosen at compile time, 32 bytes by default.
+	/// LINAVG_VERTEX_COLOR_RGBA8 packs colors to 4 bytes & LINAVG_VERTEX_UV_HALF stores uvs as half floats, 16 bytes with both.
+	/// Backends should use offsetof & sizeof(Vertex) for their attribute layouts, see LINAVG_VERTEX_COLOR_RGBA8 & LINAVG_VERTEX_UV_HALF.
+	/// </summary>
 	struct Vertex
 	{
-		Vec2 pos;
-		Vec2 uv;
-		Vec4 col;
+		Vec2		pos;
+		VertexUV	uv;
+		VertexColor col;
+
+#ifdef LINAVG_VERTEX_EDGE_AA
+		/// <summary>
+		/// Only with LINAVG_VERTEX_EDGE_AA, replacing AA fringe geometry. 1 or -1 on antialiased edges, 0 inside shapes.
+		/// Interpolated linearly, so a fragment shader gets its distance to the edge in pixels as (1 - abs(edge)) / fwidth(edge), 0 everywhere in a triangle meaning no edge at all.
+		/// </summary>
+		float edge = 0.0f;
+#endif
 	};
 
 	LINAVG_API struct Configuration
@@ -640,15 +1095,24 @@ namespace LinaVG
 		unsigned int maxFontAtlasSize = 768;
 
 		/// <summary>
-		/// Every interval ticks system will garbage collect all vertex and index buffers, meaning that will clear all the arrays.
-		/// On other ticks, arrays are simply resized to 0, avoiding re-allocations on the next frame.
-		/// Set to 0 for instant flush on buffers at the end of every frame.
-		/// Disable using gcCollectEnabled
+		/// Each buffer tracks a high-water mark of its usage, which decays by this factor every frame and grows with usage.
+		/// On ResetFrame, buffers holding more than twice their mark in capacity release the excess, spreading reallocations over frames.
+		/// 1.0f never trims, 0.0f trims towards last frame's usage.
+		/// </summary>
+		float bufferTrimDecay = 0.97f;
+
+		/// <summary>
+		/// Buffers that stay empty for this many frames in a row are released. Set to 0 to keep them forever.
+		/// </summary>
+		int bufferExpireInterval = 600;
+
+		/// <summary>
+		/// Deprecated, ignored. Buffers are trimmed every frame instead, see bufferTrimDecay & bufferExpireInterval.
 		/// </summary>
 		int gcCollectInterval = 600;
 
 		/// <summary>
-		/// Whether gcCollectInterval is used to clear all vertex/index buffers.
+		/// Deprecated, ignored. Set bufferTrimDecay to 1.0f & bufferExpireInterval to 0 to never release buffers.
 		/// </summary>
 		bool gcCollectEnabled = true;
 
@@ -659,11 +1123,12 @@ namespace LinaVG
 
 		/// <summary>
 		/// Amount of vertex buffers reserved for each buffer reserve upon initialization.
+		/// Afterwards new buffers reserve the average usage of the same kind of buffers on the last frame. Also the minimum buffers are trimmed to.
 		/// </summary>
 		int defaultVtxBufferReserve = 100;
 
 		/// <summary>
-		/// Amount of idx buffers reserved for each buffer reserve upon initialization.
+		/// Amount of idx buffers reserved for each buffer reserve upon initialization, same rules as defaultVtxBufferReserve apply.
 		/// </summary>
 		int defaultIdxBufferReserve = 100;
 
@@ -689,9 +1154,85 @@ namespace LinaVG
 		int textCacheReserve = 300;
 
 		/// <summary>
-		/// Every this amount of ticks the text caches will be cleared up to prevent memory bloating.
+		/// Maximum bytes of cached vertices, indices & strings per Drawer, least recently used texts are evicted beyond it.
+		/// Texts bigger than the budget aren't cached.
+		/// </summary>
+		size_t textCacheBudget = 4 * 1024 * 1024;
+
+		/// <summary>
+		/// Deprecated, ignored. The text cache is no longer cleared periodically, size it with textCacheBudget instead.
 		/// </summary>
 		int textCacheExpireInterval = 3000;
+
+		/// <summary>
+		/// If enabled, FlushBuffers packs the geometry of all buffers into one contiguous frame-wide vertex arena and one index arena before drawing.
+		/// Each DrawBuffer then describes its range in the arenas via vertexOffset/vertexCount and indexOffset/indexCount, indices being relative to vertexOffset.
+		/// Use BufferStoreCallbacks::uploadFrame to upload the whole frame once, then issue base-vertex draws in your draw callback.
+		/// Buffers are still recorded into their own arrays and copied into the arenas once per flush. Those arrays keep their capacity between frames (see bufferTrimDecay),
+		/// set a LinearAllocator on the Drawer to keep the remaining per-frame allocations off the heap.
+		/// </summary>
+		bool frameArenaEnabled = false;
+
+		/// <summary>
+		/// If enabled, FlushBuffers concatenates buffers that are next to each other in draw order and share the same shape type, texture, clip, user data and unique ID.
+		/// Handy if draw orders are used purely for layering, merged draws keep the draw order of the first buffer in the batch.
+		/// </summary>
+		bool batchMergingEnabled = false;
+
+		/// <summary>
+		/// Used by deferred Drawers to tessellate their commands, should run task(0) to task(taskCount - 1), e.g. on your job system, and return once all are done.
+		/// If not set, each Drawer runs them on a pool of hardware_concurrency - 1 threads it starts on first use, along with the calling thread.
+		/// </summary>
+		std::function<void(int taskCount, const std::function<void(int taskIndex)>& task)> parallelFor;
+
+		/// <summary>
+		/// Minimum number of deferred commands tessellated per task, see Drawer::SetDeferred.
+		/// </summary>
+		int deferredChunkSize = 256;
+
+		/// <summary>
+		/// DrawLines calls with at least this many points are stroked in parallel chunks, via parallelFor or the Drawer's thread pool. 0 disables it.
+		/// Output is the same as stroking serially, chunk seams that don't match are restroked. Ignored while tessellating deferred commands.
+		/// </summary>
+		int parallelLineThreshold = 0;
+
+		/// <summary>
+		/// Minimum number of line segments stroked per task, see parallelLineThreshold. Tasks keep their buffers for the next calls.
+		/// </summary>
+		int lineChunkSize = 4096;
+
+		/// <summary>
+		/// If enabled, Draw calls with a non-zero uniqueID in their style or text options are cached by their unique ID & the order they're drawn in with it each frame.
+		/// Drawing them again with the same geometry, style, clip rect & AA settings as last frame copies the cached vertices instead of tessellating, a hash of these is compared.
+		/// Changed parameters are tessellated again on their own, Drawer::InvalidateShapeCache forces it, e.g. once a texture's contents change. Deferred workers share the drawer's cache.
+		/// </summary>
+		bool shapeCachingEnabled = false;
+
+		/// <summary>
+		/// Cached shapes that weren't drawn for this many frames are released.
+		/// </summary>
+		int shapeCacheExpireInterval = 120;
+
+		/// <summary>
+		/// If enabled, DrawRect & full circle DrawCircle calls emit a single ShapeInstance each into DrawBufferShapeType::Instanced buffers instead of tessellating.
+		/// Your backend needs to draw these, e.g. expanding each instance to a quad & shading it via a signed distance function, see the GL example backend.
+		/// Styles using textures, rect position overrides, outline gradients or outline directions other than Outwards are still tessellated.
+		/// </summary>
+		bool instancedShapesEnabled = false;
+
+		/// <summary>
+		/// If enabled, AA fringes are written right after the triangles they belong to, into the same buffer, instead of separate DrawBufferShapeType::AA buffers.
+		/// Saves a draw call & buffer lookup per AA'd style, fringes are then drawn along with their shape instead of after all shapes of their draw order.
+		/// Fringes that don't fit the vertex limit of their shape's buffer still go to an AA buffer.
+		/// </summary>
+		bool aaInFillBufferEnabled = false;
+
+		/// <summary>
+		/// Maximum distance in pixels tessellated curves may stray from the true ones. If above 0, segment counts of circles, arcs, rounded rect & triangle corners, round joints and line caps are derived from their radius,
+		/// so a small corner gets a few vertices while a big one stays smooth. 0 keeps the fixed, rounding based counts. 0.25f - 0.5f is visually lossless at 1:1 scale.
+		/// Segment counts given explicitly to DrawCircle always override it.
+		/// </summary>
+		float flatnessTolerance = 0.0f;
 	};
 
 	/// <summary>
@@ -712,6 +1253,51 @@ namespace LinaVG
 		Text,
 		SDFText,
 		AA,
+		Instanced,
+	};
+
+	/// <summary>
+	/// A rounded rectangle or circle drawn without tessellation, see Config.instancedShapesEnabled.
+	/// The shape is the box of halfSize around center with the given corner radii, rotated by rotation around center.
+	/// Distances below are in pixels, measured outwards from the box's edge.
+	/// </summary>
+	struct ShapeInstance
+	{
+		Vec2 center;
+		Vec2 halfSize;
+
+		/// <summary>
+		/// Top left, top right, bottom right and bottom left, circles have all equal to their radius.
+		/// </summary>
+		Vec4 cornerRadii;
+
+		/// <summary>
+		/// Fill gradient, running from the left or top edge to the right or bottom edge of the unrotated box.
+		/// </summary>
+		VertexColor	 colorStart;
+		VertexColor	 colorEnd;
+		GradientType gradientType = GradientType::None;
+
+		/// <summary>
+		/// Radians, clockwise.
+		/// </summary>
+		float rotation = 0.0f;
+
+		/// <summary>
+		/// 0.0f for filled shapes, otherwise the shape is hollow, covering 0.0f to thickness.
+		/// </summary>
+		float thickness = 0.0f;
+
+		/// <summary>
+		/// Outline covers the thickness of the shape up to outlineThickness more, in outlineColor.
+		/// </summary>
+		float		outlineThickness = 0.0f;
+		VertexColor outlineColor;
+
+		/// <summary>
+		/// Width the outer & inner edges fade out in, 0.0f if AA is disabled.
+		/// </summary>
+		float aaThickness = 0.0f;
 	};
 
 	struct DrawBuffer
@@ -723,15 +1309,32 @@ namespace LinaVG
 			this->clip = clip;
 		};
 
-		Array<Vertex>		vertexBuffer;
-		Array<Index>		indexBuffer;
-		DrawBufferShapeType shapeType	  = DrawBufferShapeType::Shape;
-		TextureHandle		textureHandle = NULL_TEXTURE;
-		Vec4				textureUV	  = Vec4(1.0f, 1.0f, 0.0f, 0.0f);
-		Vec4i				clip		  = Vec4i(0.0f, 0.0f, 0.0f, 0.0f);
-		void*				userData	  = nullptr;
-		int					drawOrder	  = -1;
-		uint64_t			uid			  = 0;
+		Array<Vertex>		 vertexBuffer;
+		Array<Index>		 indexBuffer;
+		Array<ShapeInstance> instanceBuffer;
+		DrawBufferShapeType	 shapeType	   = DrawBufferShapeType::Shape;
+		TextureHandle		 textureHandle = NULL_TEXTURE;
+		Vec4				 textureUV	   = Vec4(1.0f, 1.0f, 0.0f, 0.0f);
+		Vec4i				 clip		   = Vec4i(0.0f, 0.0f, 0.0f, 0.0f);
+		void*				 userData	   = nullptr;
+		int					 drawOrder	   = -1;
+		uint64_t			 uid		   = 0;
+
+		/// <summary>
+		/// Decaying peak of vertex & index usage, see Config.bufferTrimDecay. unusedFrames counts the frames this buffer stayed empty in a row.
+		/// </summary>
+		int vertexHighWater	  = 0;
+		int indexHighWater	  = 0;
+		int instanceHighWater = 0;
+		int unusedFrames	  = 0;
+
+		/// <summary>
+		/// Range of this buffer within the frame arenas, only valid during FlushBuffers if Config.frameArenaEnabled is set.
+		/// </summary>
+		int vertexOffset = 0;
+		int vertexCount	 = 0;
+		int indexOffset	 = 0;
+		int indexCount	 = 0;
 
 		bool IsClipDifferent(const Vec4i& clip)
 		{
@@ -742,12 +1345,33 @@ namespace LinaVG
 		{
 			vertexBuffer.clear();
 			indexBuffer.clear();
+			instanceBuffer.clear();
 		}
 
 		inline void ShrinkZero()
 		{
 			vertexBuffer.shrink(0);
 			indexBuffer.shrink(0);
+			instanceBuffer.shrink(0);
+		}
+
+		/// <summary>
+		/// Returns whether there is nothing to draw, instances for DrawBufferShapeType::Instanced buffers, triangles otherwise.
+		/// </summary>
+		inline bool IsEmpty() const
+		{
+			if (shapeType == DrawBufferShapeType::Instanced)
+				return instanceBuffer.m_size == 0;
+
+			return vertexBuffer.m_size == 0 || indexBuffer.m_size == 0;
+		}
+
+		/// <summary>
+		/// Returns whether the given amount of vertices can be added without exceeding the index range.
+		/// </summary>
+		inline bool CanFitVertices(int count) const
+		{
+			return count <= LINAVG_MAX_BUFFER_VERTICES - vertexBuffer.m_size;
 		}
 
 		inline void PushVertex(const Vertex& v)
@@ -760,6 +1384,30 @@ namespace LinaVG
 			indexBuffer.push_back(i);
 		}
 
+		/// <summary>
+		/// Appends a range of vertices with a single copy.
+		/// </summary>
+		inline void PushVertices(const Vertex* vertices, int count)
+		{
+			vertexBuffer.append(vertices, count);
+		}
+
+		/// <summary>
+		/// Appends a range of indices, adding baseVertex to each.
+		/// </summary>
+		inline void PushIndices(const Index* indices, int count, int baseVertex = 0)
+		{
+			if (baseVertex == 0)
+				indexBuffer.append(indices, count);
+			else
+				indexBuffer.append_rebased(indices, count, static_cast<Index>(baseVertex));
+		}
+
+		inline void PushIndices(const int* indices, int count, int baseVertex = 0)
+		{
+			indexBuffer.append_rebased(indices, count, baseVertex);
+		}
+
 		inline Vertex* LastVertex()
 		{
 			return vertexBuffer.last();
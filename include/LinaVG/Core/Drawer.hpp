@@ -40,11 +40,7 @@ OF THE POSSIBILITY OF SUCH DAMAGE.
 namespace LinaVG
 {
 	class Font;
-
-	struct LineTriangle
-	{
-		int m_indices[3];
-	};
+	class TaskPool;
 
 	struct TextPart
 	{
@@ -52,35 +48,51 @@ namespace LinaVG
 		Vec2		  m_size = Vec2(0.0f, 0.0f);
 	};
 
-	struct Line
+	/// <summary>
+	/// Segment of a polyline stroked by Drawer::DrawLines. Corners are upper start, upper end, lower end & lower start.
+	/// Joints move the corners of the segment being added, then the end corners of the previous one in place, already written to the buffer.
+	/// </summary>
+	struct LineSegment
 	{
-		Array<Vertex>		m_vertices;
-		Array<int>			m_upperIndices;
-		Array<int>			m_lowerIndices;
-		Array<LineTriangle> m_tris;
-		bool				m_hasMidpoints		 = false;
-		int					m_lineCapVertexCount = 0;
-
-		Line& operator=(const Line& t)
-		{
-			m_vertices.m_data = nullptr;
-			m_vertices.m_size = m_vertices.m_capacity = m_vertices.m_lastSize = 0;
-			m_tris.m_data													  = nullptr;
-			m_tris.m_size = m_tris.m_capacity = m_tris.m_lastSize = 0;
-			m_lowerIndices.m_data								  = nullptr;
-			m_lowerIndices.m_size = m_lowerIndices.m_capacity = m_lowerIndices.m_lastSize = 0;
-			m_upperIndices.m_data														  = nullptr;
-			m_upperIndices.m_size = m_upperIndices.m_capacity = m_upperIndices.m_lastSize = 0;
-			m_vertices.from(t.m_vertices);
-			m_tris.from(t.m_tris);
-			m_lowerIndices.from(t.m_lowerIndices);
-			m_upperIndices.from(t.m_upperIndices);
-			m_hasMidpoints		 = t.m_hasMidpoints;
-			m_lineCapVertexCount = t.m_lineCapVertexCount;
-			return *this;
-		}
+		Vertex m_corners[4];
+		Vec2   m_up				= Vec2(0.0f, 0.0f);
+		Vec2   m_startMid		= Vec2(0.0f, 0.0f);
+		Vec2   m_endMid			= Vec2(0.0f, 0.0f);
+		float  m_width			= 0.0f;
+		int	   m_base			= 0;
+		int	   m_vertexCount	= 0;
+		bool   m_skipUpperStart = false;
+		bool   m_skipLowerStart = false;
+	};
 
-		Line() = default;
+	/// <summary>
+	/// Output of Drawer::StrokeLines, a whole polyline or a chunk of it. Upper & lower indices are only filled if outlines or AA need them.
+	/// Entry is the state the first written segment started from, exit the state of the segment after the last written one, as joined to it.
+	/// </summary>
+	struct LineStroke
+	{
+		DrawBuffer* buf = nullptr;
+		Array<int>	upperIndices;
+		Array<int>	lowerIndices;
+		LineSegment entry;
+		LineSegment exit;
+	};
+
+	/// <summary>
+	/// Chunk of a polyline stroked in parallel into its own buffer, then copied to its offsets in the destination buffer, see Config.parallelLineThreshold.
+	/// </summary>
+	struct LineChunk
+	{
+		DrawBuffer buffer;
+		LineStroke stroke;
+		Vec2	   bbMin		= Vec2(0.0f, 0.0f);
+		Vec2	   bbMax		= Vec2(0.0f, 0.0f);
+		int		   firstSegment = 0;
+		int		   endSegment	= 0;
+		int		   vertexOffset = 0;
+		int		   indexOffset	= 0;
+		int		   upperOffset	= 0;
+		int		   lowerOffset	= 0;
 	};
 
 	struct SimpleLine
@@ -104,9 +116,77 @@ namespace LinaVG
 		Both
 	};
 
+	enum class DeferredCommandType
+	{
+		Bezier,
+		QuadBezier,
+		Line,
+		Lines,
+		Image,
+		Triangle,
+		Rect,
+		NGon,
+		Convex,
+		Circle,
+		Arc,
+		Text,
+		DrawList,
+	};
+
+	/// <summary>
+	/// A Draw call recorded in deferred mode, tessellated at flush.
+	/// Styles are stored separately and referenced by optionsIndex, point & text data by dataOffset/dataCount.
+	/// Commands missing the shape cache reference the entry they're tessellated into by cacheIndex.
+	/// </summary>
+	struct DeferredCommand
+	{
+		DeferredCommandType type		 = DeferredCommandType::Rect;
+		int					drawOrder	 = 0;
+		float				rotateAngle	 = 0.0f;
+		int					optionsIndex = 0;
+		int					dataOffset	 = 0;
+		int					dataCount	 = 0;
+		Vec4i				clip;
+		Vec2				points[4];
+		Vec4				vectors[2];
+		float				floats[3]	  = {0.0f, 0.0f, 0.0f};
+		int					ints[3]		  = {0, 0, 0};
+		TextureHandle		textureHandle = NULL_TEXTURE;
+		int					cacheIndex	  = -1;
+		bool				flag		  = false;
+	};
+
+	// Commands live in an Array, which grows them with realloc.
+	static_assert(std::is_trivially_copyable_v<DeferredCommand>, "DeferredCommand must be trivially copyable.");
+
+	/// <summary>
+	/// Geometry of a single cached Draw call, see Config.shapeCachingEnabled.
+	/// </summary>
+	struct ShapeCache
+	{
+		DrawList list;
+		uint64_t paramHash = 0;
+		uint32_t version   = 0;
+		bool	 recorded  = false;
+	};
+
+	/// <summary>
+	/// Cached Draw calls sharing a unique ID, indexed by the order they're drawn in each frame.
+	/// </summary>
+	struct ShapeCacheGroup
+	{
+		LINAVG_VEC<ShapeCache*> entries;
+		uint32_t				version	  = 0;
+		int						frame	  = -1;
+		int						drawCount = 0;
+	};
+
 	class Drawer
 	{
 	public:
+		Drawer() = default;
+		~Drawer();
+
 		/// <summary>
 		/// Draws a bezier curve defined by the start, end and control points.
 		/// </summary>
@@ -118,8 +198,35 @@ namespace LinaVG
 		/// <param name="cap">Puts a line cap to either first, last or both ends.</param>
 		/// <param name="jointType">Determines how to join the lines.</param>
 		/// <param name="drawOrder">Shapes with lower draw order is drawn first, resulting at the very bottom Z layer.</param>
-		/// <param name="segments"> Determines the smoothness of the curve. 0-100 range, 100 smoothest. </param>
-		LINAVG_API void DrawBezier(const Vec2& p0, const Vec2& p1, const Vec2& p2, const Vec2& p3, StyleOptions& style, LineCapDirection cap = LineCapDirection::None, LineJointType jointType = LineJointType::Miter, int drawOrder = 0, int segments = 50);
+		/// <param name="segments"> Determines the smoothness of the curve. 0-100 range, 100 smoothest, flattening it within 1 to 0.02 pixels. Straighter parts get fewer points. -1, the default, uses Config.flatnessTolerance, or 50 if the tolerance is 0. </param>
+		LINAVG_API void DrawBezier(const Vec2& p0, const Vec2& p1, const Vec2& p2, const Vec2& p3, StyleOptions& style, LineCapDirection cap = LineCapDirection::None, LineJointType jointType = LineJointType::Miter, int drawOrder = 0, int segments = -1);
+
+		/// <summary>
+		/// Draws a quadratic bezier curve defined by the start, end and control points.
+		/// </summary>
+		/// <param name="p0">Start point.</param>
+		/// <param name="p1">Control point.</param>
+		/// <param name="p2">End point.</param>
+		/// <param name="style">Style options.</param>
+		/// <param name="cap">Puts a line cap to either first, last or both ends.</param>
+		/// <param name="jointType">Determines how to join the lines.</param>
+		/// <param name="drawOrder">Shapes with lower draw order is drawn first, resulting at the very bottom Z layer.</param>
+		/// <param name="segments"> Determines the smoothness of the curve, same as DrawBezier, -1 being automatic. </param>
+		LINAVG_API void DrawQuadBezier(const Vec2& p0, const Vec2& p1, const Vec2& p2, StyleOptions& style, LineCapDirection cap = LineCapDirection::None, LineJointType jointType = LineJointType::Miter, int drawOrder = 0, int segments = -1);
+
+		/// <summary>
+		/// Draws a stroked arc, going clock-wise from start to end angle. Use DrawCircle for filled pies.
+		/// </summary>
+		/// <param name="center">Center of the arc.</param>
+		/// <param name="radius">Radius of the arc, lines are centered on it.</param>
+		/// <param name="startAngle">Start angle in degrees.</param>
+		/// <param name="endAngle">End angle in degrees, an end angle not past the start angle wraps around once.</param>
+		/// <param name="style">Style options.</param>
+		/// <param name="cap">Puts a line cap to either first, last or both ends.</param>
+		/// <param name="jointType">Determines how to join the lines.</param>
+		/// <param name="drawOrder">Shapes with lower draw order is drawn first, resulting at the very bottom Z layer.</param>
+		/// <param name="segments">Segments a full circle would have, same as DrawCircle, the arc getting its share of them. 0 derives it from the radius & Config.flatnessTolerance, or uses 36 if the tolerance is 0. </param>
+		LINAVG_API void DrawArc(const Vec2& center, float radius, float startAngle, float endAngle, StyleOptions& style, LineCapDirection cap = LineCapDirection::None, LineJointType jointType = LineJointType::Miter, int drawOrder = 0, int segments = 0);
 
 		/// <summary>
 		/// Draws a single point.
@@ -138,7 +245,7 @@ namespace LinaVG
 		LINAVG_API void DrawLine(const Vec2& p1, const Vec2& p2, StyleOptions& style, LineCapDirection cap = LineCapDirection::None, float rotateAngle = 0.0f, int drawOrder = 0);
 
 		/// <summary>
-		/// Draws multiple lines defined by the given path.
+		/// Draws multiple lines defined by the given path. Very long paths can be stroked in parallel, see Config.parallelLineThreshold.
 		/// </summary>
 		/// <param name="points">Line path, needs to be at least 3 points.</param>
 		/// <param name="count">Total number of points in the given path.</param>
@@ -213,13 +320,13 @@ namespace LinaVG
 		/// <param name="center">Center of the shape.</param>
 		/// <param name="radius">Radius of the shape.</param>
 		/// <param name="style">Style options.</param>
-		/// <param name="segments">Defines the smoothness of the circle, default 36. Clamped to 6-360, 360 being perfect circle. Higher the segment cause more weight on the performance. 18-54 is a good range for balance. Always recommended to use segments that leave no remainder when 360 is divided by it. </param>
+		/// <param name="segments">Defines the smoothness of the circle, clamped to 6-180. Higher the segment cause more weight on the performance. 18-54 is a good range for balance. Always recommended to use segments that leave no remainder when 360 is divided by it. 0 derives it from the radius & Config.flatnessTolerance, or uses 36 if the tolerance is 0. </param>
 		/// <param name="rotateAngle">Rotates the whole shape by the given angle (degrees).</param>
 		/// <param name="startAngle">Use start and end angle to draw semi-circles or arcs. Leave empty (0.0f, 360.0f) for complete circles.</param>
 		/// <param name="endAngle">Use start and end angle to draw semi-circles or arcs. Leave empty (0.0f, 360.0f) for complete circles.</param>
 		/// <param name="drawOrder">Shapes with lower draw order is drawn first, resulting at the very bottom Z layer.</param>
 		/// <returns></returns>
-		LINAVG_API void DrawCircle(const Vec2& center, float radius, StyleOptions& style, int segments = 36, float rotateAngle = 0.0f, float startAngle = 0.0f, float endAngle = 360.0f, int drawOrder = 0);
+		LINAVG_API void DrawCircle(const Vec2& center, float radius, StyleOptions& style, int segments = 0, float rotateAngle = 0.0f, float startAngle = 0.0f, float endAngle = 360.0f, int drawOrder = 0);
 
 #ifndef LINAVG_DISABLE_TEXT_SUPPORT
 
@@ -250,25 +357,92 @@ namespace LinaVG
 
 		inline LINAVG_API void SetClipRect(const Vec4i& rect)
 		{
-			m_bufferStore.SetClipRect(rect);
+			GetRecordData().m_clipRect = rect;
 		}
 
-		inline LINAVG_API void FlushBuffers()
+		/// <summary>
+		/// Until EndDrawList, all Draw calls are tessellated into the given list instead of this drawer's buffers.
+		/// The list is cleared first, clip rects set during recording are recorded too. Deferred mode is suspended while recording.
+		/// </summary>
+		LINAVG_API void BeginDrawList(DrawList& list);
+
+		/// <summary>
+		/// Stops recording into the list given to BeginDrawList.
+		/// </summary>
+		LINAVG_API void EndDrawList();
+
+		/// <summary>
+		/// Copies all geometry of a recorded list into this drawer's buffers, without tessellating anything.
+		/// The list can be replayed any number of times, on any frame, as long as its textures and fonts are alive.
+		/// In deferred mode the copy is recorded like a Draw call, the list must stay alive until FlushBuffers.
+		/// </summary>
+		/// <param name="list">List to replay.</param>
+		/// <param name="translation">Added to all vertex positions and recorded clip rects. Text is moved by it rounded to whole pixels, like it's laid out.</param>
+		/// <param name="drawOrderOffset">Added to all recorded draw orders.</param>
+		LINAVG_API void ReplayDrawList(const DrawList& list, const Vec2& translation = Vec2(0.0f, 0.0f), int drawOrderOffset = 0);
+
+		/// <summary>
+		/// In deferred mode Draw calls only record commands, which are tessellated in parallel chunks on FlushBuffers.
+		/// Each chunk is tessellated into its own worker context, see Config.parallelFor & Config.deferredChunkSize.
+		/// Workers are then copied into this drawer's buffers in chunk order, so the output is the same as drawing immediately.
+		/// DrawTextDefault calls requesting TextOutData lay the text out right away to fill it, and are tessellated in order like others.
+		/// </summary>
+		inline LINAVG_API void SetDeferred(bool deferred)
 		{
-			m_bufferStore.FlushBuffers();
+			m_deferred = deferred;
 		}
 
-		inline LINAVG_API void ResetFrame()
+		inline LINAVG_API bool IsDeferred() const
 		{
-			m_bufferStore.ResetFrame();
+			return m_deferred;
 		}
 
+		LINAVG_API void FlushBuffers();
+
+		/// <summary>
+		/// Each Drawer is a recording context owning its own buffers, so separate Drawers can be recorded on separate threads at the same time.
+		/// Once all of them are done, flushes this drawer together with the given ones via this drawer's callbacks, in a deterministic order.
+		/// Fonts must be loaded and added to atlases before recording starts, as they are shared between contexts.
+		/// </summary>
+		/// <param name="contexts">Other drawers to flush with, ties in draw order are drawn in the order given here, after this drawer.</param>
+		/// <param name="contextCount">Number of drawers in contexts, at most LINAVG_MAX_RECORDING_CONTEXTS - 1.</param>
+		LINAVG_API void FlushBuffers(Drawer* const* contexts, int contextCount);
+
+		LINAVG_API void ResetFrame();
+
+		/// <summary>
+		/// Cached shapes with the given unique ID are tessellated again the next time they're drawn, see Config.shapeCachingEnabled.
+		/// </summary>
+		LINAVG_API void InvalidateShapeCache(uint64_t uid);
+
+		/// <summary>
+		/// All cached shapes are tessellated again the next time they're drawn, e.g. after reloading a font they use.
+		/// </summary>
+		LINAVG_API void InvalidateShapeCache();
+
+		/// <summary>
+		/// Sets the allocator backing this drawer's buffers & recorded commands, see BufferStore::SetAllocator.
+		/// Deferred worker contexts, shape caches and draw lists keep using LINAVG_MALLOC & LINAVG_FREE.
+		/// </summary>
+		LINAVG_API void SetAllocator(Allocator* allocator);
+
+		/// <summary>
+		/// Text cache counters & memory, summed over this drawer and its deferred worker contexts.
+		/// </summary>
+		LINAVG_API TextCacheStats GetTextCacheStats() const;
+
 		inline LINAVG_API BufferStoreCallbacks& GetCallbacks()
 		{
 			return m_bufferStore.GetCallbacks();
 		}
 
 	private:
+		// Buffers Draw calls are tessellated into, the draw list being recorded if any.
+		inline BufferStoreData& GetRecordData()
+		{
+			return m_drawList != nullptr ? m_drawList->GetData() : m_bufferStore.GetData();
+		}
+
 		enum class OutlineCallType
 		{
 			Normal,
@@ -276,6 +450,49 @@ namespace LinaVG
 			OutlineAA
 		};
 
+		// Records a deferred command with the current clip rect.
+		DeferredCommand& RecordDeferred(DeferredCommandType type, float rotateAngle, int drawOrder);
+
+		// Records the style to be referenced by a deferred command.
+		int RecordDeferredStyle(const StyleOptions& style);
+
+		// Records the points to be referenced by a deferred command.
+		void RecordDeferredPoints(DeferredCommand& cmd, const Vec2* points, int count);
+
+		// Whether a Draw call with the given unique ID goes through the shape cache.
+		bool IsShapeCacheable(uint64_t uid);
+
+		// Called once a command is recorded, replays it from the shape cache or has it tessellated into it.
+		void FinishRecord();
+
+		// Next cache entry of the given unique ID this frame.
+		ShapeCache& AcquireShapeCache(uint64_t uid, uint32_t& version);
+
+		// Hash of everything a recorded command is tessellated from, its cache entry is recorded again once it differs.
+		uint64_t HashDeferredCommand(const DeferredCommand& cmd) const;
+
+		// Tessellates all recorded commands into worker contexts, then copies them into this drawer's buffers in chunk order.
+		void TessellateDeferred();
+
+		// Tessellates the given command with this drawer, which is never in deferred mode.
+		void ReplayDeferred(const Drawer& source, const DeferredCommand& cmd);
+
+		// Copies buffers into the record data, merging them into buffers of the same state like Draw calls do.
+		void AppendBuffers(const Array<DrawBuffer>& buffers, const Vec2& translation, int drawOrderOffset);
+
+		// Runs task(0) to task(taskCount - 1) via Config.parallelFor, or on m_taskPool if it isn't set.
+		void RunParallel(int taskCount, const std::function<void(int taskIndex)>& task);
+
+		// Strokes segments firstSegment to endSegment - 1 of the polyline into a single buffer, splitting them if they don't fit its index range.
+		void DrawLinesRange(Vec2* points, int count, int firstSegment, int endSegment, StyleOptions& opts, LineCapDirection cap, LineJointType jointType, int drawOrder);
+
+		// Draws the segment range in two halves, used when it doesn't fit in a single buffer's index range.
+		void DrawLinesSplit(Vec2* points, int count, int firstSegment, int endSegment, StyleOptions& opts, LineCapDirection cap, LineJointType jointType, int drawOrder);
+
+		// Emit the shape as a single ShapeInstance if Config.instancedShapesEnabled is set & the style allows it, return whether they did.
+		bool DrawRectInstance(const Vec2& min, const Vec2& max, const StyleOptions& style, float rotateAngle, int drawOrder);
+		bool DrawCircleInstance(const Vec2& center, float radius, const StyleOptions& style, float startAngle, float endAngle, int drawOrder);
+
 		// No rounding, single color
 		void FillRect_NoRound(DrawBuffer* buf, float rotateAngle, const Vec2& min, const Vec2& max, StyleOptions& opts, int drawOrder);
 
@@ -339,8 +556,12 @@ namespace LinaVG
 		/// </summary>
 		void CalculateVertexUVs(DrawBuffer* buf, int startIndex, int endIndex);
 
-		// Angle increment based on rounding value.
-		float GetAngleIncrease(float rounding);
+		// Angle increment of rounded corners, based on radius if Config.flatnessTolerance is set, rounding value otherwise.
+		float GetAngleIncrease(float rounding, float radius);
+
+		// Upper bounds of the vertices FillRect_Round & FillTri_Round push, outlines excluded. Used as buffer hints so a shape never straddles a rolled over buffer.
+		int GetRoundedRectVertexCount(const Vec2& min, const Vec2& max, const StyleOptions& style);
+		int GetRoundedTriVertexCount(const Vec2& top, const Vec2& right, const Vec2& left, const StyleOptions& style);
 
 		/// <summary>
 		/// Returns the direction vector going from the center of the arc towards it's middle angle.
@@ -357,12 +578,29 @@ namespace LinaVG
 		bool IsPointInside(const Vec2& point, const Vec4& rect);
 
 		/// Line calculation methods.
-		void	   CalculateLine(Line& line, const Vec2& p1, const Vec2& p2, StyleOptions& style, LineCapDirection lineCapToAdd);
-		void	   JoinLines(Line& line1, Line& line2, StyleOptions& opts, LineJointType joinType, bool mergeUpperVertices);
 		void	   DrawSimpleLine(SimpleLine& line, StyleOptions& style, float rotateAngle, int drawOrder);
-		void	   CalculateLineUVs(Line& line);
 		SimpleLine CalculateSimpleLine(const Vec2& p1, const Vec2& p2, StyleOptions& style);
 
+		/// <summary>
+		/// Strokes segments firstSegment to endSegment - 1 of the polyline into stroke.buf in a single pass, keeping only the previous segment around to join with.
+		/// The first segment starts from stroke.entry if useEntry is set, otherwise a few segments before it are stroked & discarded to join it.
+		/// </summary>
+		void StrokeLines(LineStroke& stroke, Vec2* points, int count, int firstSegment, int endSegment, bool useEntry, const StyleOptions& opts, StyleOptions& style, LineCapDirection cap, LineJointType jointType, bool addUpperLowerIndices);
+
+		/// <summary>
+		/// Strokes segments firstSegment to endSegment - 1 of the polyline in chunks in parallel, then restrokes the chunks whose seams don't match serial stroking. Returns the total vertex count.
+		/// </summary>
+		int StrokeLineChunks(Vec2* points, int count, int firstSegment, int endSegment, const StyleOptions& opts, LineCapDirection cap, LineJointType jointType, bool addUpperLowerIndices);
+
+		/// <summary>
+		/// Copies the stroked chunks to buf in parallel, calculating uvs & colors on the way. Fills m_lineStroke's upper & lower indices.
+		/// </summary>
+		void WriteLineChunks(DrawBuffer* buf, const Vec4Grad& color);
+
+		void CalculateLineSegment(LineSegment& segment, const Vec2& p1, const Vec2& p2, StyleOptions& style);
+		void JoinLineSegments(LineStroke& stroke, LineSegment& prev, LineSegment& next, StyleOptions& opts, LineJointType jointType, bool mergeUpperVertices, bool addUpperLowerIndices);
+		void WriteLineSegment(LineStroke& stroke, LineSegment& segment, StyleOptions& style, LineCapDirection lineCapToAdd, bool addUpperLowerIndices);
+
 		/// <summary>
 		/// Draws an outline (or AA) around the vertices given, following the specific draw order via index array.
 		/// Used for semi-circles, arcs, lines and alike.
@@ -380,6 +618,13 @@ namespace LinaVG
 		/// <returns></returns>
 		DrawBuffer* DrawOutline(DrawBuffer* sourceBuffer, StyleOptions& opts, int vertexCount, bool skipEnds = false, int drawOrder = 0, OutlineCallType = OutlineCallType::Normal, bool reverseDrawDir = false);
 
+#ifdef LINAVG_VERTEX_EDGE_AA
+		/// <summary>
+		/// Sets Vertex::edge on the given inclusive range, used in place of AA outlines.
+		/// </summary>
+		void SetVertexEdges(DrawBuffer* buf, int startIndex, int endIndex, float edge);
+#endif
+
 #ifndef LINAVG_DISABLE_TEXT_SUPPORT
 
 		/// <summary>
@@ -432,7 +677,29 @@ namespace LinaVG
 #endif
 
 	private:
-		BufferStore m_bufferStore;
+		BufferStore							  m_bufferStore;
+		Array<DeferredCommand>				  m_deferredCommands;
+		Array<Vec2>							  m_deferredPoints;
+		Array<Vec2>							  m_curvePoints;
+		Array<int>							  m_lineOutlineIndices;
+		LineStroke							  m_lineStroke;
+		DrawBuffer							  m_textScratch;
+		Array<char>							  m_deferredText;
+		LINAVG_VEC<StyleOptions>			  m_deferredStyles;
+		LINAVG_VEC<TextOptions>				  m_deferredTextOptions;
+		LINAVG_VEC<const DrawList*>			  m_deferredDrawLists;
+		LINAVG_VEC<ShapeCache*>				  m_deferredShapeCaches;
+		LINAVG_VEC<Drawer*>					  m_deferredWorkers;
+		LINAVG_VEC<LineChunk*>				  m_lineChunks;
+		LINAVG_MAP<uint64_t, ShapeCacheGroup> m_shapeCache;
+		DrawList*							  m_drawList			= nullptr;
+		TaskPool*							  m_taskPool			= nullptr;
+		int									  m_deferredWorkersUsed = 0;
+		int									  m_shapeCacheFrame		= 0;
+		int									  m_lineChunksUsed		= 0;
+		bool								  m_deferred			= false;
+		bool								  m_deferredWorker		= false;
+		bool								  m_drawListDeferred	= false;
 	};
 
 } // namespace LinaVG
@@ -35,6 +35,7 @@ OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
 #include "Common.hpp"
+#include <cmath>
 
 namespace LinaVG
 {
@@ -50,11 +51,13 @@ namespace LinaVG
 		static Vec2	 Normalized(const Vec2& v);
 		static Vec2	 Rotate90(const Vec2& v, bool ccw = true);
 		static Vec2	 GetPointOnCircle(const Vec2& center, float radius, float angle); // Angle in degrees.
+		static float GetFlatnessAngle(float radius, float tolerance);				   // Largest angle in degrees a chord of a circle can span while staying within tolerance of its arc.
 		static Vec2	 SampleParabola(const Vec2& p1, const Vec2& p2, const Vec2& direction, float height, float t);
 		static Vec2	 SampleBezier(const Vec2& p0, const Vec2& p1, const Vec2& p2, const Vec2& p3, float t);
 		static Vec2	 LineIntersection(const Vec2& p00, const Vec2& p01, const Vec2& p10, const Vec2& p11);
 		static bool	 AreLinesParallel(const Vec2& p00, const Vec2& p01, const Vec2& p10, const Vec2& p11);
 		static Vec2	 RotateAround(const Vec2& point, const Vec2& center, float angle);
+		static Vec2	 RotateAround(const Vec2& point, const Vec2& center, float cosAngle, float sinAngle); // Precomputed cos & sin of the angle, for rotating many points.
 		static Vec2	 Abs(const Vec2& v);
 		static Vec2	 Clamp(const Vec2& v, const Vec2& min, const Vec2& max);
 		static Vec2	 ScalePoint(const Vec2& p, const Vec2& center, float scale);
@@ -115,4 +118,43 @@ namespace LinaVG
 		}
 	};
 
+	/// <summary>
+	/// Walks points on a circle in fixed angle steps via a rotation recurrence, so cos & sin are only evaluated on construction instead of per point.
+	/// Accumulates in double precision, the drift over a full circle of 1 degree steps stays far below a pixel.
+	/// </summary>
+	class ArcStepper
+	{
+	public:
+		ArcStepper(const Vec2& center, float radius, float startAngle, float angleIncrease) // Angles in degrees.
+		{
+			const double deg2Rad = static_cast<double>(LVG_DEG2RAD);
+			m_center			 = center;
+			m_radius			 = static_cast<double>(radius);
+			m_cos				 = std::cos(deg2Rad * startAngle);
+			m_sin				 = std::sin(deg2Rad * startAngle);
+			m_stepCos			 = std::cos(deg2Rad * angleIncrease);
+			m_stepSin			 = std::sin(deg2Rad * angleIncrease);
+		}
+
+		/// <summary>
+		/// Returns the point at the current angle, then advances by the angle increase.
+		/// </summary>
+		inline Vec2 Next()
+		{
+			const Vec2	 p = Vec2(static_cast<float>(m_radius * m_cos) + m_center.x, static_cast<float>(m_radius * m_sin) + m_center.y);
+			const double c = m_cos * m_stepCos - m_sin * m_stepSin;
+			m_sin		   = m_sin * m_stepCos + m_cos * m_stepSin;
+			m_cos		   = c;
+			return p;
+		}
+
+	private:
+		Vec2   m_center	 = Vec2(0.0f, 0.0f);
+		double m_radius	 = 0.0;
+		double m_cos	 = 1.0;
+		double m_sin	 = 0.0;
+		double m_stepCos = 1.0;
+		double m_stepSin = 0.0;
+	};
+
 } // namespace LinaVG
@@ -88,6 +88,11 @@ namespace LinaVG
 
 		void DestroyBuffers();
 
+		/// <summary>
+		/// Read-only glyph lookup, safe to call from multiple threads. Returns an empty character if the font doesn't have the glyph.
+		/// </summary>
+		const TextCharacter& GetGlyph(GlyphEncoding c) const;
+
 		~Font()
 		{
 			DestroyBuffers();
@@ -105,7 +110,7 @@ namespace LinaVG
 			unsigned int height = 0;
 		};
 
-		Atlas(const Vec2ui& size, std::function<void(Atlas* atlas)> updateFunc);
+		Atlas(const Vec2ui& size, std::function<void(Atlas* atlas)> updateFunc, Allocator* allocator = nullptr);
 		~Atlas();
 
 		void Destroy();
@@ -125,8 +130,9 @@ namespace LinaVG
 	private:
 		std::function<void(Atlas* atlas)> m_updateFunc;
 		LINAVG_VEC<Slice*>				  m_availableSlices;
-		Vec2ui							  m_size = Vec2ui();
-		uint8_t*						  m_data = nullptr;
+		Vec2ui							  m_size	  = Vec2ui();
+		uint8_t*						  m_data	  = nullptr;
+		Allocator*						  m_allocator = nullptr;
 	};
 
 	struct Callbacks
@@ -203,6 +209,12 @@ namespace LinaVG
 		/// <returns></returns>
 		LINAVG_API void RemoveFontFromAtlas(Font* font);
 
+		/// <summary>
+		/// Sets the allocator backing atlases created from now on, nullptr to use LINAVG_MALLOC & LINAVG_FREE. Must not be frame scoped.
+		/// Glyph bitmaps of fonts are loaded without an instance, so they keep using LINAVG_MALLOC.
+		/// </summary>
+		LINAVG_API void SetAllocator(Allocator* allocator);
+
 		/// <summary>
 		/// Returns the kerning vector between two given glphys.
 		/// </summary>
@@ -216,6 +228,7 @@ namespace LinaVG
 	private:
 		LINAVG_VEC<Atlas*> m_atlases;
 		Callbacks		   m_callbacks;
+		Allocator*		   m_allocator = nullptr;
 
 	}; // namespace Text
 
@@ -45,13 +45,7 @@ namespace LinaVG
 		Vec4(){};
 		Vec4(float x, float y, float z, float w)
 			: x(x), y(y), z(z), w(w){};
-		Vec4(const Vec4& v)
-		{
-			this->x = v.x;
-			this->y = v.y;
-			this->z = v.z;
-			this->w = v.w;
-		}
+		Vec4(const Vec4& v) = default;
 
 		float x = 0.0f;
 		float y = 0.0f;
@@ -64,11 +58,7 @@ namespace LinaVG
 		Vec2(){};
 		Vec2(float x, float y)
 			: x(x), y(y){};
-		Vec2(const Vec2& v)
-		{
-			x = v.x;
-			y = v.y;
-		}
+		Vec2(const Vec2& v) = default;
 
 		float x = 0.0f;
 		float y = 0.0f;
@@ -79,11 +69,7 @@ namespace LinaVG
 		Vec2ui(){};
 		Vec2ui(unsigned int x, unsigned int y)
 			: x(x), y(y){};
-		Vec2ui(const Vec2ui& v)
-		{
-			x = v.x;
-			y = v.y;
-		}
+		Vec2ui(const Vec2ui& v) = default;
 		Vec2ui(const Vec2& v)
 		{
 			x = static_cast<unsigned int>(v.x);
@@ -99,13 +85,7 @@ namespace LinaVG
 		Vec4i(){};
 		Vec4i(int x, int y, int z, int w)
 			: x(x), y(y), z(z), w(w){};
-		Vec4i(const Vec4i& v)
-		{
-			x = v.x;
-			y = v.y;
-			z = v.z;
-			w = v.w;
-		}
+		Vec4i(const Vec4i& v) = default;
 
 		bool operator==(const Vec4i& other) const
 		{
@@ -126,13 +106,7 @@ namespace LinaVG
 		Vec4ui(){};
 		Vec4ui(unsigned int x, unsigned int y, unsigned int z, unsigned int w)
 			: x(x), y(y), z(z), w(w){};
-		Vec4ui(const Vec4ui& v)
-		{
-			x = v.x;
-			y = v.y;
-			z = v.z;
-			w = v.w;
-		}
+		Vec4ui(const Vec4ui& v) = default;
 
 		Vec4ui(const Vec2ui& p, const Vec2ui& s)
 		{
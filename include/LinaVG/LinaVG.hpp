@@ -36,3 +36,4 @@ OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "Core/Text.hpp"
 #include "Core/Drawer.hpp"
+#include "Core/Allocator.hpp"
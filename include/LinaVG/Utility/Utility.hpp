@@ -156,6 +156,110 @@ namespace LinaVG
 		int	 GetTextCharacterSize(const char* text);
 		Vec4 HexToVec4(int hex);
 
+		/// <summary>
+		/// Stable LSD radix sort on 64 bit keys, byte per pass. Passes where all keys share the same byte are skipped.
+		/// Scratch is resized to the key count and can be kept around to avoid reallocations.
+		/// </summary>
+		void RadixSort(Array<uint64_t>& keys, Array<uint64_t>& scratch);
+
+		/// <summary>
+		/// Copies count vertices from src to dst, adding offset to their positions. SSE2 when available, dst may equal src.
+		/// </summary>
+		void TranslateVertices(Vertex* dst, const Vertex* src, int count, const Vec2& offset);
+
+		/// <summary>
+		/// Copies count vertices from src to dst, applying pos' = R * (pos - center) * scale + center * scale + offset, R rotating by angle degrees.
+		/// Falls back to TranslateVertices without rotation & scale. SSE2 when available, dst may equal src.
+		/// </summary>
+		void TransformText(Vertex* dst, const Vertex* src, int count, const Vec2& center, const Vec2& offset, float scale, float angle);
+
+		/// <summary>
+		/// Copies count indices from src to dst, adding baseVertex to each. SSE2 when available, dst may equal src.
+		/// </summary>
+		void RebaseIndices(Index* dst, const Index* src, int count, int baseVertex);
+
+		/// <summary>
+		/// Instruction sets the vertex kernels below can run with.
+		/// </summary>
+		enum class SIMDLevel
+		{
+			Scalar,
+			SSE2,
+			AVX2,
+			NEON,
+		};
+
+		/// <summary>
+		/// Level the vertex kernels run with, the best one supported by both the build and the CPU unless overridden via SetSIMDLevel.
+		/// Vectorized kernels need the default 32 byte Vertex layout, others always run scalar.
+		/// </summary>
+		SIMDLevel GetSIMDLevel();
+
+		/// <summary>
+		/// Overrides the detected level, e.g. to compare against Scalar. Unsupported levels reset to the detected one. Not thread safe, set before drawing.
+		/// </summary>
+		void SetSIMDLevel(SIMDLevel level);
+
+		/// <summary>
+		/// Rotates the positions of count vertices around center by angle degrees.
+		/// </summary>
+		void RotateVertices(Vertex* vertices, int count, const Vec2& center, float angle);
+
+		/// <summary>
+		/// Bounding box of the positions of count vertices.
+		/// </summary>
+		void GetVerticesBoundingBox(const Vertex* vertices, int count, Vec2& outMin, Vec2& outMax);
+
+		/// <summary>
+		/// Remaps the positions of count vertices from bbMin-bbMax to 0-1 uvs.
+		/// </summary>
+		void CalculateVertexUVs(Vertex* vertices, int count, const Vec2& bbMin, const Vec2& bbMax);
+
+		/// <summary>
+		/// Colors count vertices, gradients are sampled along the vertices' uvs. preserveAlpha keeps their current alpha.
+		/// </summary>
+		void CalculateVertexColors(Vertex* vertices, int count, const Vec4Grad& color, bool preserveAlpha);
+
+		/// <summary>
+		/// CalculateVertexUVs followed by CalculateVertexColors, in cache sized blocks.
+		/// </summary>
+		void CalculateVertexUVsAndColors(Vertex* vertices, int count, const Vec2& bbMin, const Vec2& bbMax, const Vec4Grad& color, bool preserveAlpha);
+
+		/// <summary>
+		/// 64 bit FNV-1a hash of a null terminated string.
+		/// </summary>
+		inline uint64_t HashString(const char* str)
+		{
+			uint64_t hash = 14695981039346656037ull;
+
+			while (*str != '\0')
+			{
+				hash ^= static_cast<unsigned char>(*str++);
+				hash *= 1099511628211ull;
+			}
+
+			return hash;
+		}
+
+		/// <summary>
+		/// Mixes value into seed, boost::hash_combine style on 64 bits.
+		/// </summary>
+		inline uint64_t HashCombine(uint64_t seed, uint64_t value)
+		{
+			return seed ^ (value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2));
+		}
+
+		/// <summary>
+		/// Bit pattern of the float, -0.0f being folded into 0.0f so values comparing equal hash equal.
+		/// </summary>
+		inline uint64_t HashFloat(float f)
+		{
+			const float folded = f + 0.0f;
+			uint32_t	bits   = 0;
+			LINAVG_MEMCPY(&bits, &folded, sizeof(float));
+			return static_cast<uint64_t>(bits);
+		}
+
 	} // namespace Utility
 } // namespace LinaVG
 #endif
@@ -0,0 +1,230 @@
+/*
+This file is a part of: LinaVG
+https://github.com/inanevin/LinaVG
+
+Author: Inan Evin
+http://www.inanevin.com
+
+The 2-Clause BSD License
+
+Copyright (c) [2022-] Inan Evin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+   1. Redistributions of source code must retain the above copyright notice, this
+	  list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright notice,
+	  this list of conditions and the following disclaimer in the documentation
+	  and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "LinaVG/Core/Allocator.hpp"
+
+namespace LinaVG
+{
+	LinearAllocator::LinearAllocator(size_t blockSize)
+		: m_blockSize(blockSize)
+	{
+	}
+
+	LinearAllocator::~LinearAllocator()
+	{
+		for (Block& block : m_blocks)
+			HeapFree(block.data, block.size);
+
+		m_blocks.clear();
+	}
+
+	void* LinearAllocator::DoAllocate(size_t size)
+	{
+		const size_t alignedSize = (size + 15) & ~static_cast<size_t>(15);
+
+		while (m_currentBlock < m_blocks.size())
+		{
+			Block& block = m_blocks[m_currentBlock];
+
+			if (block.used + alignedSize <= block.size)
+			{
+				void* ptr = block.data + block.used;
+				block.used += alignedSize;
+				return ptr;
+			}
+
+			m_currentBlock++;
+		}
+
+		Block block;
+		block.size = alignedSize > m_blockSize ? alignedSize : m_blockSize;
+		block.data = static_cast<char*>(HeapAllocate(block.size));
+		block.used = alignedSize;
+		m_blocks.push_back(block);
+		m_currentBlock = m_blocks.size() - 1;
+		return block.data;
+	}
+
+	void* LinearAllocator::DoReallocate(void* ptr, size_t oldSize, size_t newSize)
+	{
+		// The latest allocation can grow in place if its block has room.
+		if (m_currentBlock < m_blocks.size())
+		{
+			Block&		 block		= m_blocks[m_currentBlock];
+			const size_t oldAligned = (oldSize + 15) & ~static_cast<size_t>(15);
+			const size_t newAligned = (newSize + 15) & ~static_cast<size_t>(15);
+			char*		 blockEnd	= block.data + block.used;
+
+			if (static_cast<char*>(ptr) + oldAligned == blockEnd)
+			{
+				if (block.used - oldAligned + newAligned <= block.size)
+				{
+					block.used = block.used - oldAligned + newAligned;
+					return ptr;
+				}
+
+				// Alone in the last block, so the whole block grows instead, which the heap can often do in place.
+				if (ptr == block.data && m_currentBlock == m_blocks.size() - 1)
+				{
+					char* data = static_cast<char*>(HeapReallocate(block.data, block.size, newAligned));
+
+					if (data != nullptr)
+					{
+						block.data = data;
+						block.size = newAligned;
+						block.used = newAligned;
+						return data;
+					}
+				}
+			}
+		}
+
+		return Allocator::DoReallocate(ptr, oldSize, newSize);
+	}
+
+	void LinearAllocator::DoFree(void* /*ptr*/, size_t /*size*/)
+	{
+		// Released all at once on ResetFrame.
+	}
+
+	void LinearAllocator::DoResetFrame()
+	{
+		// Merge the blocks so the next frame of the same size fits in one.
+		if (m_blocks.size() > 1)
+		{
+			size_t totalSize = 0;
+
+			for (Block& block : m_blocks)
+			{
+				totalSize += block.size;
+				HeapFree(block.data, block.size);
+			}
+
+			m_blocks.clear();
+
+			Block merged;
+			merged.size = totalSize;
+			merged.data = static_cast<char*>(HeapAllocate(totalSize));
+			m_blocks.push_back(merged);
+		}
+
+		for (Block& block : m_blocks)
+			block.used = 0;
+
+		m_currentBlock = 0;
+	}
+
+	PoolAllocator::PoolAllocator(size_t maxPooledSize)
+		: m_maxPooledSize(maxPooledSize)
+	{
+	}
+
+	PoolAllocator::~PoolAllocator()
+	{
+		Release();
+	}
+
+	void PoolAllocator::Release()
+	{
+		for (int i = 0; i < POOL_CLASS_COUNT; i++)
+		{
+			const size_t classSize = static_cast<size_t>(1) << (i + POOL_MIN_SHIFT);
+
+			while (m_freeLists[i] != nullptr)
+			{
+				void* next = *static_cast<void**>(m_freeLists[i]);
+				HeapFree(m_freeLists[i], classSize);
+				m_freeLists[i] = next;
+			}
+		}
+	}
+
+	int PoolAllocator::GetSizeClass(size_t size) const
+	{
+		if (size > m_maxPooledSize)
+			return -1;
+
+		int	   sizeClass = 0;
+		size_t classSize = static_cast<size_t>(1) << POOL_MIN_SHIFT;
+
+		while (classSize < size)
+		{
+			classSize <<= 1;
+			sizeClass++;
+		}
+
+		return sizeClass < POOL_CLASS_COUNT ? sizeClass : -1;
+	}
+
+	void* PoolAllocator::DoAllocate(size_t size)
+	{
+		const int sizeClass = GetSizeClass(size);
+
+		if (sizeClass == -1)
+			return HeapAllocate(size);
+
+		void* ptr = m_freeLists[sizeClass];
+
+		if (ptr == nullptr)
+			return HeapAllocate(static_cast<size_t>(1) << (sizeClass + POOL_MIN_SHIFT));
+
+		m_freeLists[sizeClass] = *static_cast<void**>(ptr);
+		return ptr;
+	}
+
+	void* PoolAllocator::DoReallocate(void* ptr, size_t oldSize, size_t newSize)
+	{
+		// Still fits the size class it came from.
+		const int sizeClass = GetSizeClass(oldSize);
+		if (sizeClass != -1 && sizeClass == GetSizeClass(newSize))
+			return ptr;
+
+		return Allocator::DoReallocate(ptr, oldSize, newSize);
+	}
+
+	void PoolAllocator::DoFree(void* ptr, size_t size)
+	{
+		const int sizeClass = GetSizeClass(size);
+
+		if (sizeClass == -1)
+		{
+			HeapFree(ptr, size);
+			return;
+		}
+
+		*static_cast<void**>(ptr) = m_freeLists[sizeClass];
+		m_freeLists[sizeClass]	  = ptr;
+	}
+
+} // namespace LinaVG
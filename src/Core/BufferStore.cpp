@@ -41,12 +41,38 @@ OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "LinaVG/Utility/Utility.hpp"
 #include <math.h>
 #include <cassert>
+#include <utility>
 
 namespace LinaVG
 {
+	namespace
+	{
+		// Draw command key layout, most significant first: draw order (32 bits, sign flipped), shape type (4 bits), context (6 bits), buffer index (22 bits).
+		constexpr uint64_t DRAW_CMD_INDEX_BITS	 = 22;
+		constexpr uint64_t DRAW_CMD_INDEX_MASK	 = (1ull << DRAW_CMD_INDEX_BITS) - 1;
+		constexpr uint64_t DRAW_CMD_CONTEXT_BITS = 6;
+		constexpr uint64_t DRAW_CMD_CONTEXT_MASK = (1ull << DRAW_CMD_CONTEXT_BITS) - 1;
+		constexpr uint64_t DRAW_CMD_SHAPE_BITS	 = 4;
+		static_assert(LINAVG_MAX_RECORDING_CONTEXTS <= (1 << DRAW_CMD_CONTEXT_BITS), "Recording contexts don't fit in draw command keys!");
+
+		// Decays the high-water mark towards the current usage, releasing capacity once it's more than twice the mark, then empties the array.
+		template <typename T> void TrimToHighWater(Array<T>& arr, int& highWater, int minimum)
+		{
+			const int decayed = static_cast<int>(static_cast<float>(highWater) * Config.bufferTrimDecay);
+			highWater		  = Math::Max(arr.m_size, decayed);
+
+			const int target = Math::Max(highWater, minimum);
+			if (arr.m_capacity > target * 2)
+				arr.trim(target);
+
+			arr.shrink(0);
+		}
+	} // namespace
+
 	BufferStore::BufferStore()
 	{
 		m_data.m_defaultBuffers.reserve(Config.defaultBufferReserve);
+		m_data.m_defaultBufferLookup.reserve(Config.defaultBufferReserve);
 
 		if (Config.textCachingEnabled)
 			m_data.m_textCache.reserve(Config.textCacheReserve);
@@ -57,72 +83,218 @@ namespace LinaVG
 		ClearAllBuffers();
 	}
 
-	void BufferStore::ClearAllBuffers()
+	DrawList::~DrawList()
+	{
+		Clear();
+	}
+
+	void DrawList::Clear()
+	{
+		for (int i = 0; i < m_data.m_defaultBuffers.m_size; i++)
+			m_data.m_defaultBuffers[i].Clear();
+
+		m_data.m_defaultBuffers.clear();
+		m_data.m_defaultBufferLookup.clear();
+		m_data.ClearTextCache();
+		m_data.m_clipRect = Vec4i(0, 0, 0, 0);
+	}
+
+	bool DrawList::IsEmpty() const
 	{
-		m_data.m_gcFrameCounter = 0;
+		for (int i = 0; i < m_data.m_defaultBuffers.m_size; i++)
+		{
+			if (!m_data.m_defaultBuffers[i].IsEmpty())
+				return false;
+		}
+
+		return true;
+	}
 
+	void BufferStore::ClearAllBuffers()
+	{
 		for (int i = 0; i < m_data.m_defaultBuffers.m_size; i++)
 			m_data.m_defaultBuffers[i].Clear();
 
 		m_data.m_defaultBuffers.clear();
+		m_data.m_defaultBufferLookup.clear();
+		m_data.m_lookupDirty = false;
+
+		m_data.m_drawCommandKeys.clear();
+		m_data.m_drawCommandScratch.clear();
+		m_data.m_drawCommands.clear();
+		m_data.m_frameVertices.clear();
+		m_data.m_frameIndices.clear();
+		m_data.ClearMergedBuffers();
+	}
 
-		m_data.m_drawOrders.clear();
+	void BufferStore::SetAllocator(Allocator* allocator)
+	{
+		ClearAllBuffers();
+		m_data.ClearTextCache();
+		m_data.m_allocator = allocator;
+
+		Allocator* persistent					= m_data.GetPersistentAllocator();
+		m_data.m_defaultBuffers.m_allocator		= persistent;
+		m_data.m_drawCommandKeys.m_allocator	= persistent;
+		m_data.m_drawCommandScratch.m_allocator = persistent;
+		m_data.m_drawCommands.m_allocator		= persistent;
+		m_data.m_frameVertices.m_allocator		= allocator;
+		m_data.m_frameIndices.m_allocator		= allocator;
 	}
 
 	void BufferStore::ResetFrame()
 	{
-		m_data.m_gcFrameCounter++;
-
-		if (Config.gcCollectEnabled && m_data.m_gcFrameCounter > Config.gcCollectInterval)
+		auto& buffers								= m_data.m_defaultBuffers;
+		int	  vertexTotals[DRAW_BUFFER_SHAPE_TYPES] = {};
+		int	  indexTotals[DRAW_BUFFER_SHAPE_TYPES]	= {};
+		int	  usedBuffers[DRAW_BUFFER_SHAPE_TYPES]	= {};
+		int	  alive									= 0;
+		bool  frameScoped							= m_data.m_allocator != nullptr && m_data.m_allocator->IsFrameScoped();
+
+		for (int i = 0; i < buffers.m_size; i++)
 		{
-			ClearAllBuffers();
+			DrawBuffer& buf = buffers[i];
+
+			if (buf.vertexBuffer.m_size == 0 && buf.instanceBuffer.m_size == 0)
+				buf.unusedFrames++;
+			else
+			{
+				const int type = static_cast<int>(buf.shapeType);
+				vertexTotals[type] += buf.vertexBuffer.m_size;
+				indexTotals[type] += buf.indexBuffer.m_size;
+				usedBuffers[type]++;
+				buf.unusedFrames = 0;
+			}
+
+			if (Config.bufferExpireInterval > 0 && buf.unusedFrames > Config.bufferExpireInterval)
+			{
+				buf.Clear();
+				continue;
+			}
+
+			if (frameScoped)
+			{
+				// Arena is rewound below, buffers reserve their high-water mark from it again.
+				buf.vertexHighWater	  = Math::Max(buf.vertexBuffer.m_size, static_cast<int>(static_cast<float>(buf.vertexHighWater) * Config.bufferTrimDecay));
+				buf.indexHighWater	  = Math::Max(buf.indexBuffer.m_size, static_cast<int>(static_cast<float>(buf.indexHighWater) * Config.bufferTrimDecay));
+				buf.instanceHighWater = Math::Max(buf.instanceBuffer.m_size, static_cast<int>(static_cast<float>(buf.instanceHighWater) * Config.bufferTrimDecay));
+				buf.vertexBuffer.detach();
+				buf.indexBuffer.detach();
+				buf.instanceBuffer.detach();
+			}
+			else
+			{
+				TrimToHighWater(buf.vertexBuffer, buf.vertexHighWater, Config.defaultVtxBufferReserve);
+				TrimToHighWater(buf.indexBuffer, buf.indexHighWater, Config.defaultIdxBufferReserve);
+				TrimToHighWater(buf.instanceBuffer, buf.instanceHighWater, 0);
+			}
+
+			// Survivors keep their order, moving takes over their arrays & leaves the source empty.
+			if (alive != i)
+				buffers[alive] = std::move(buf);
+
+			alive++;
 		}
-		else
+
+		if (alive != buffers.m_size)
 		{
-			for (int i = 0; i < m_data.m_defaultBuffers.m_size; i++)
-				m_data.m_defaultBuffers[i].ShrinkZero();
+			buffers.shrink(alive);
+			m_data.m_lookupDirty = true;
 		}
 
-		if (Config.textCachingEnabled)
-			m_data.m_textCacheFrameCounter++;
+		if (m_data.m_lookupDirty)
+			m_data.RebuildLookup();
 
-		if (m_data.m_textCacheFrameCounter > Config.textCacheExpireInterval)
+		for (int i = 0; i < DRAW_BUFFER_SHAPE_TYPES; i++)
 		{
-			m_data.m_textCacheFrameCounter = 0;
-			m_data.m_textCache.clear();
+			if (usedBuffers[i] == 0)
+				continue;
+
+			m_data.m_vtxReserveHints[i] = vertexTotals[i] / usedBuffers[i];
+			m_data.m_idxReserveHints[i] = indexTotals[i] / usedBuffers[i];
 		}
-	}
 
-	void BufferStore::FlushBuffers()
-	{
-		int	 thread		 = 0;
-		auto renderBuffs = [this, thread](int drawOrder, DrawBufferShapeType shapeType) {
-			for (int i = 0; i < m_data.m_defaultBuffers.m_size; i++)
+		// Merged buffers never use frame scoped memory, they're trimmed the same either way.
+		m_data.TrimMergedBuffers();
+
+		if (frameScoped)
+		{
+			m_data.m_frameVertices.detach();
+			m_data.m_frameIndices.detach();
+			m_data.m_allocator->ResetFrame();
+
+			for (int i = 0; i < buffers.m_size; i++)
 			{
-				DrawBuffer& buf = m_data.m_defaultBuffers[i];
+				DrawBuffer& buf = buffers[i];
 
-				if (buf.drawOrder == drawOrder && buf.shapeType == shapeType && buf.vertexBuffer.m_size != 0 && buf.indexBuffer.m_size != 0)
+				if (buf.shapeType == DrawBufferShapeType::Instanced)
 				{
-					if (m_callbacks.draw)
-						m_callbacks.draw(&buf);
-					else
-					{
-						if (LinaVG::Config.logCallback)
-							LinaVG::Config.logCallback("LinaVG: No callback is setup for Draw");
-					}
+					buf.instanceBuffer.reserve(buf.instanceHighWater);
+					continue;
 				}
+
+				buf.vertexBuffer.reserve(Math::Max(buf.vertexHighWater, Config.defaultVtxBufferReserve));
+				buf.indexBuffer.reserve(Math::Max(buf.indexHighWater, Config.defaultIdxBufferReserve));
 			}
-		};
+		}
+		else
+		{
+			TrimToHighWater(m_data.m_frameVertices, m_data.m_frameVtxHighWater, 0);
+			TrimToHighWater(m_data.m_frameIndices, m_data.m_frameIdxHighWater, 0);
+
+			if (m_data.m_allocator != nullptr)
+				m_data.m_allocator->ResetFrame();
+		}
+	}
+
+	void BufferStore::FlushBuffers()
+	{
+		FlushBuffers(nullptr, 0);
+	}
+
+	void BufferStore::FlushBuffers(BufferStore* const* contexts, int contextCount)
+	{
+		if (contextCount > LINAVG_MAX_RECORDING_CONTEXTS - 1)
+		{
+			if (Config.errorCallback)
+				Config.errorCallback("LinaVG: Too many recording contexts, extra contexts won't be drawn!");
+			contextCount = LINAVG_MAX_RECORDING_CONTEXTS - 1;
+		}
+
+		BufferStoreData* data[LINAVG_MAX_RECORDING_CONTEXTS];
+		data[0] = &m_data;
+		for (int i = 0; i < contextCount; i++)
+			data[i + 1] = &contexts[i]->m_data;
+
+		m_data.BuildDrawCommands(data, contextCount + 1);
+
+		if (Config.batchMergingEnabled)
+			m_data.MergeDrawCommands();
+
+		auto& commands = m_data.m_drawCommands;
+
+		if (Config.frameArenaEnabled)
+		{
+			m_data.PackFrameArena();
 
-		auto& arr = m_data.m_drawOrders;
+			if (m_callbacks.uploadFrame)
+				m_callbacks.uploadFrame(m_data.m_frameVertices, m_data.m_frameIndices);
+			else
+			{
+				if (LinaVG::Config.logCallback)
+					LinaVG::Config.logCallback("LinaVG: No callback is setup for UploadFrame");
+			}
+		}
 
-		for (int i = 0; i < arr.m_size; i++)
+		for (int i = 0; i < commands.m_size; i++)
 		{
-			const int drawOrder = arr[i];
-			renderBuffs(drawOrder, DrawBufferShapeType::Shape);
-			renderBuffs(drawOrder, DrawBufferShapeType::Text);
-			renderBuffs(drawOrder, DrawBufferShapeType::SDFText);
-			renderBuffs(drawOrder, DrawBufferShapeType::AA);
+			if (m_callbacks.draw)
+				m_callbacks.draw(commands[i]);
+			else
+			{
+				if (LinaVG::Config.logCallback)
+					LinaVG::Config.logCallback("LinaVG: No callback is setup for Draw");
+			}
 		}
 	}
 
@@ -131,106 +303,411 @@ namespace LinaVG
 		m_data.m_clipRect = rect;
 	}
 
-	DrawBuffer& BufferStoreData::GetDefaultBuffer(void* userData, uint64_t uid, int drawOrder, DrawBufferShapeType shapeType, TextureHandle txtHandle, const Vec4& textureUV)
+	DrawBuffer& BufferStoreData::GetDefaultBuffer(void* userData, uint64_t uid, int drawOrder, DrawBufferShapeType shapeType, TextureHandle txtHandle, const Vec4& textureUV, int vertexCountHint)
 	{
-		for (int i = 0; i < m_defaultBuffers.m_size; i++)
+		const uint64_t hash		  = GetDefaultBufferHash(userData, uid, drawOrder, shapeType, txtHandle, textureUV, m_clipRect);
+		auto		   it		  = m_defaultBufferLookup.find(hash);
+		bool		   ownsLookup = it == m_defaultBufferLookup.end();
+
+		if (it != m_defaultBufferLookup.end())
 		{
-			auto& buf = m_defaultBuffers[i];
+			int index = -1;
 
-			if (buf.shapeType != shapeType)
-				continue;
+			if (IsDefaultBufferMatching(m_defaultBuffers[it->second], userData, uid, drawOrder, shapeType, txtHandle, textureUV))
+			{
+				index	   = it->second;
+				ownsLookup = true;
+			}
+			else
+			{
+				// Hash collision, fall back to scanning.
+				for (int i = 0; i < m_defaultBuffers.m_size; i++)
+				{
+					if (IsDefaultBufferMatching(m_defaultBuffers[i], userData, uid, drawOrder, shapeType, txtHandle, textureUV))
+					{
+						index = i;
+						break;
+					}
+				}
+			}
 
-			if (buf.userData != userData)
-				continue;
+			// If full, continue with buffers rolled over from it on earlier frames, they are drawn right after.
+			while (index != -1 && !m_defaultBuffers[index].CanFitVertices(vertexCountHint))
+			{
+				int next = -1;
+				for (int i = index + 1; i < m_defaultBuffers.m_size; i++)
+				{
+					if (IsDefaultBufferMatching(m_defaultBuffers[i], userData, uid, drawOrder, shapeType, txtHandle, textureUV))
+					{
+						next = i;
+						break;
+					}
+				}
 
-			if (buf.drawOrder != drawOrder)
-				continue;
+				index = next;
+			}
 
-			if (buf.IsClipDifferent(m_clipRect))
-				continue;
+			if (index != -1)
+			{
+				// Lookup follows the buffer being filled, ResetFrame points it to the first one again.
+				if (ownsLookup && it->second != index)
+				{
+					it->second	  = index;
+					m_lookupDirty = true;
+				}
 
-			if (buf.textureHandle != txtHandle)
-				continue;
+				return m_defaultBuffers[index];
+			}
+		}
 
-			if (!Math::IsEqual(buf.textureUV, textureUV))
-				continue;
+		if (vertexCountHint > LINAVG_MAX_BUFFER_VERTICES)
+		{
+			if (Config.errorCallback)
+				Config.errorCallback("LinaVG: Shape exceeds the vertex limit of a single buffer, build with LINAVG_32BIT_INDICES to draw it!");
+		}
 
-			if (buf.uid != uid)
-				continue;
+		m_defaultBuffers.emplace_back(userData, uid, drawOrder, shapeType, txtHandle, textureUV, m_clipRect);
 
-			return buf;
+		// Colliding keys keep the lookup of the first state, others are found via the scan above.
+		if (ownsLookup)
+		{
+			m_lookupDirty				= m_lookupDirty || it != m_defaultBufferLookup.end();
+			m_defaultBufferLookup[hash] = m_defaultBuffers.m_size - 1;
 		}
 
-		SetDrawOrderLimits(drawOrder);
-		m_defaultBuffers.push_back(DrawBuffer(userData, uid, drawOrder, shapeType, txtHandle, textureUV, m_clipRect));
-		DrawBuffer& buf = m_defaultBuffers.last_ref();
-		buf.vertexBuffer.reserve(Config.defaultVtxBufferReserve);
-		buf.indexBuffer.reserve(Config.defaultIdxBufferReserve);
+		// Size new buffers after what the same kind of buffers used last frame.
+		const int	vtxHint = m_vtxReserveHints[static_cast<int>(shapeType)];
+		const int	idxHint = m_idxReserveHints[static_cast<int>(shapeType)];
+		DrawBuffer& buf		= m_defaultBuffers.last_ref();
+
+		buf.vertexBuffer.m_allocator   = m_allocator;
+		buf.indexBuffer.m_allocator	   = m_allocator;
+		buf.instanceBuffer.m_allocator = m_allocator;
+
+		// Instances don't use vertices, they grow on their own.
+		if (shapeType == DrawBufferShapeType::Instanced)
+			return buf;
+
+		buf.vertexBuffer.reserve(vtxHint == 0 ? Config.defaultVtxBufferReserve : vtxHint);
+		buf.indexBuffer.reserve(idxHint == 0 ? Config.defaultIdxBufferReserve : idxHint);
 		return buf;
 	}
 
-	void BufferStoreData::AddTextCache(uint32_t sid, const TextOptions& opts, DrawBuffer* buf, int vtxStart, int indexStart)
+	uint64_t BufferStoreData::GetDefaultBufferHash(void* userData, uint64_t uid, int drawOrder, DrawBufferShapeType shapeType, TextureHandle txtHandle, const Vec4& textureUV, const Vec4i& clip) const
+	{
+		uint64_t hash = static_cast<uint64_t>(shapeType);
+		hash		  = Utility::HashCombine(hash, static_cast<uint64_t>(reinterpret_cast<uintptr_t>(userData)));
+		hash		  = Utility::HashCombine(hash, static_cast<uint64_t>(static_cast<uint32_t>(drawOrder)));
+		hash		  = Utility::HashCombine(hash, static_cast<uint64_t>(static_cast<uint32_t>(clip.x)) | (static_cast<uint64_t>(static_cast<uint32_t>(clip.y)) << 32));
+		hash		  = Utility::HashCombine(hash, static_cast<uint64_t>(static_cast<uint32_t>(clip.z)) | (static_cast<uint64_t>(static_cast<uint32_t>(clip.w)) << 32));
+		hash		  = Utility::HashCombine(hash, static_cast<uint64_t>(reinterpret_cast<uintptr_t>(txtHandle)));
+		hash		  = Utility::HashCombine(hash, Utility::HashFloat(textureUV.x) | (Utility::HashFloat(textureUV.y) << 32));
+		hash		  = Utility::HashCombine(hash, Utility::HashFloat(textureUV.z) | (Utility::HashFloat(textureUV.w) << 32));
+		hash		  = Utility::HashCombine(hash, uid);
+		return hash;
+	}
+
+	void BufferStoreData::RebuildLookup()
+	{
+		m_defaultBufferLookup.clear();
+
+		for (int i = 0; i < m_defaultBuffers.m_size; i++)
+		{
+			const DrawBuffer& buf = m_defaultBuffers[i];
+			m_defaultBufferLookup.emplace(GetDefaultBufferHash(buf.userData, buf.uid, buf.drawOrder, buf.shapeType, buf.textureHandle, buf.textureUV, buf.clip), i);
+		}
+
+		m_lookupDirty = false;
+	}
+
+	bool BufferStoreData::IsDefaultBufferMatching(const DrawBuffer& buf, void* userData, uint64_t uid, int drawOrder, DrawBufferShapeType shapeType, TextureHandle txtHandle, const Vec4& textureUV) const
+	{
+		return buf.shapeType == shapeType && buf.userData == userData && buf.drawOrder == drawOrder && buf.clip == m_clipRect && buf.textureHandle == txtHandle && Math::IsEqual(buf.textureUV, textureUV) && buf.uid == uid;
+	}
+
+	void BufferStoreData::AddTextCache(uint64_t key, const char* text, const TextOptions& opts, const Vec2& center, DrawBuffer* buf, int vtxStart, int indexStart)
 	{
-		TextCache& newCache = m_textCache[sid];
-		newCache.opts		= opts;
+		const int	 vtxCount = buf->vertexBuffer.m_size - vtxStart;
+		const int	 idxCount = buf->indexBuffer.m_size - indexStart;
+		const size_t bytes	  = static_cast<size_t>(vtxCount) * sizeof(Vertex) + static_cast<size_t>(idxCount) * sizeof(Index) + std::strlen(text);
+
+		if (bytes > Config.textCacheBudget)
+			return;
+
+		auto [it, inserted] = m_textCache.try_emplace(key);
+
+		TextCache& newCache = it->second;
+
+		if (!inserted)
+		{
+			UnlinkTextCache(&newCache);
+			m_textCacheBytes -= newCache.bytes;
+		}
+
+		newCache.opts	= opts;
+		newCache.text	= text;
+		newCache.key	= key;
+		newCache.bytes	= bytes;
+		newCache.center = center;
 		newCache.indxBuffer.clear();
 		newCache.vtxBuffer.clear();
+		newCache.indxBuffer.m_allocator = GetPersistentAllocator();
+		newCache.vtxBuffer.m_allocator	= GetPersistentAllocator();
 
-		for (int i = vtxStart; i < buf->vertexBuffer.m_size; i++)
-			newCache.vtxBuffer.push_back(buf->vertexBuffer[i]);
+		newCache.vtxBuffer.append(buf->vertexBuffer.m_data + vtxStart, vtxCount);
+		newCache.indxBuffer.append_rebased(buf->indexBuffer.m_data + indexStart, idxCount, static_cast<Index>(-vtxStart));
 
-		for (int i = indexStart; i < buf->indexBuffer.m_size; i++)
-			newCache.indxBuffer.push_back(buf->indexBuffer[i] - vtxStart);
+		LinkTextCache(&newCache);
+		m_textCacheBytes += bytes;
+
+		while (m_textCacheBytes > Config.textCacheBudget && m_textCacheTail != &newCache)
+		{
+			TextCache* evicted = m_textCacheTail;
+			UnlinkTextCache(evicted);
+			m_textCacheBytes -= evicted->bytes;
+			m_textCacheStats.evictions++;
+			m_textCache.erase(evicted->key);
+		}
 	}
 
-	TextCache* BufferStoreData::CheckTextCache(uint32_t sid, const TextOptions& opts, DrawBuffer* buf)
+	TextCache* BufferStoreData::CheckTextCache(uint64_t key, const char* text, const TextOptions& opts, DrawBuffer* buf, const Vec2& offset, float scale, float rotateAngle)
 	{
-		auto it = m_textCache.find(sid);
+		auto it = m_textCache.find(key);
 
-		if (it == m_textCache.end())
+		// Both the text & options are compared, so colliding keys are a miss rather than the wrong text.
+		if (it == m_textCache.end() || it->second.text != text || !it->second.opts.IsSame(opts))
+		{
+			m_textCacheStats.misses++;
 			return nullptr;
+		}
 
-		if (!it->second.opts.IsSame(opts))
-			return nullptr;
+		m_textCacheStats.hits++;
+		UnlinkTextCache(&it->second);
+		LinkTextCache(&it->second);
+
+		// Grow once, then transform & rebase straight into the buffer.
+		const TextCache& cache	  = it->second;
+		const int		 vtxStart = buf->vertexBuffer.m_size;
+		const int		 idxStart = buf->indexBuffer.m_size;
+		buf->vertexBuffer.resize(vtxStart + cache.vtxBuffer.m_size);
+		buf->indexBuffer.resize(idxStart + cache.indxBuffer.m_size);
+		Utility::TransformText(buf->vertexBuffer.m_data + vtxStart, cache.vtxBuffer.m_data, cache.vtxBuffer.m_size, cache.center, offset, scale, rotateAngle);
+		Utility::RebaseIndices(buf->indexBuffer.m_data + idxStart, cache.indxBuffer.m_data, cache.indxBuffer.m_size, vtxStart);
 
-		const int vtxStart = buf->vertexBuffer.m_size;
+		return &it->second;
+	}
 
-		for (auto& b : it->second.vtxBuffer)
-			buf->PushVertex(b);
+	void BufferStoreData::ClearTextCache()
+	{
+		m_textCache.clear();
+		m_textCacheHead	 = nullptr;
+		m_textCacheTail	 = nullptr;
+		m_textCacheBytes = 0;
+	}
 
-		for (auto& i : it->second.indxBuffer)
-			buf->PushIndex(i + vtxStart);
+	void BufferStoreData::LinkTextCache(TextCache* entry)
+	{
+		entry->prev = nullptr;
+		entry->next = m_textCacheHead;
 
-		return &it->second;
+		if (m_textCacheHead != nullptr)
+			m_textCacheHead->prev = entry;
+		else
+			m_textCacheTail = entry;
+
+		m_textCacheHead = entry;
 	}
 
-	int BufferStoreData::GetBufferIndexInDefaultArray(DrawBuffer* buf)
+	void BufferStoreData::UnlinkTextCache(TextCache* entry)
 	{
-		for (int i = 0; i < m_defaultBuffers.m_size; i++)
+		if (entry->prev != nullptr)
+			entry->prev->next = entry->next;
+		else
+			m_textCacheHead = entry->next;
+
+		if (entry->next != nullptr)
+			entry->next->prev = entry->prev;
+		else
+			m_textCacheTail = entry->prev;
+
+		entry->prev = nullptr;
+		entry->next = nullptr;
+	}
+
+	void BufferStoreData::BuildDrawCommands(BufferStoreData* const* contexts, int contextCount)
+	{
+		m_drawCommandKeys.shrink(0);
+
+		// Shape type enum values are in flush order: shapes, text, sdf text and AA.
+		for (int c = 0; c < contextCount; c++)
 		{
-			if (buf == &m_defaultBuffers[i])
-				return i;
+			const Array<DrawBuffer>& buffers = contexts[c]->m_defaultBuffers;
+
+			if (buffers.m_size > static_cast<int>(DRAW_CMD_INDEX_MASK) + 1)
+			{
+				if (Config.errorCallback)
+					Config.errorCallback("LinaVG: Too many draw buffers in a single context, extra buffers won't be drawn!");
+			}
+
+			const int bufferCount = buffers.m_size < static_cast<int>(DRAW_CMD_INDEX_MASK) + 1 ? buffers.m_size : static_cast<int>(DRAW_CMD_INDEX_MASK) + 1;
+
+			for (int i = 0; i < bufferCount; i++)
+			{
+				const DrawBuffer& buf = buffers[i];
+
+				if (buf.IsEmpty())
+					continue;
+
+				const uint64_t order = static_cast<uint64_t>(static_cast<uint32_t>(buf.drawOrder) ^ 0x80000000u);
+				const uint64_t shape = static_cast<uint64_t>(buf.shapeType);
+				const uint64_t ctx	 = static_cast<uint64_t>(c);
+				m_drawCommandKeys.push_back((order << (DRAW_CMD_SHAPE_BITS + DRAW_CMD_CONTEXT_BITS + DRAW_CMD_INDEX_BITS)) | (shape << (DRAW_CMD_CONTEXT_BITS + DRAW_CMD_INDEX_BITS)) | (ctx << DRAW_CMD_INDEX_BITS) | static_cast<uint64_t>(i));
+			}
+		}
+
+		Utility::RadixSort(m_drawCommandKeys, m_drawCommandScratch);
+
+		m_drawCommands.resize(m_drawCommandKeys.m_size);
+		for (int i = 0; i < m_drawCommandKeys.m_size; i++)
+		{
+			const uint64_t key = m_drawCommandKeys[i];
+			const int	   ctx = static_cast<int>((key >> DRAW_CMD_INDEX_BITS) & DRAW_CMD_CONTEXT_MASK);
+			m_drawCommands[i]  = &contexts[ctx]->m_defaultBuffers[static_cast<int>(key & DRAW_CMD_INDEX_MASK)];
 		}
-		return -1;
 	}
 
-	void BufferStoreData::SetDrawOrderLimits(int drawOrder)
+	void BufferStoreData::MergeDrawCommands()
 	{
-		bool found = false;
-		for (int i = 0; i < m_drawOrders.m_size; i++)
+		int	 count		= 0;
+		bool leadMerged = false;
+
+		m_mergedBuffersUsed = 0;
+
+		for (int i = 0; i < m_drawCommands.m_size; i++)
 		{
-			if (m_drawOrders[i] == drawOrder)
+			DrawBuffer& buf = *m_drawCommands[i];
+
+			if (count != 0)
 			{
-				found = true;
-				break;
+				DrawBuffer* lead	 = m_drawCommands[count - 1];
+				const bool	matching = IsDrawStateMatching(*lead, buf);
+
+				if (matching && (lead->shapeType == DrawBufferShapeType::Instanced || lead->CanFitVertices(buf.vertexBuffer.m_size)))
+				{
+					// The run's first buffer is copied once, the rest are appended to the copy.
+					if (!leadMerged)
+					{
+						DrawBuffer* merged = AcquireMergedBuffer(*lead);
+						merged->PushVertices(lead->vertexBuffer.m_data, lead->vertexBuffer.m_size);
+						merged->PushIndices(lead->indexBuffer.m_data, lead->indexBuffer.m_size);
+						merged->instanceBuffer.append(lead->instanceBuffer.m_data, lead->instanceBuffer.m_size);
+						m_drawCommands[count - 1] = merged;
+						lead					  = merged;
+						leadMerged				  = true;
+					}
+
+					const int vtxBase = lead->vertexBuffer.m_size;
+					lead->PushVertices(buf.vertexBuffer.m_data, buf.vertexBuffer.m_size);
+					lead->PushIndices(buf.indexBuffer.m_data, buf.indexBuffer.m_size, vtxBase);
+					lead->instanceBuffer.append(buf.instanceBuffer.m_data, buf.instanceBuffer.m_size);
+					continue;
+				}
 			}
+
+			m_drawCommands[count++] = m_drawCommands[i];
+			leadMerged				= false;
+		}
+
+		m_drawCommands.resize(count);
+	}
+
+	DrawBuffer* BufferStoreData::AcquireMergedBuffer(const DrawBuffer& lead)
+	{
+		// Heap allocated, m_drawCommands keeps pointing at them while more are added.
+		if (m_mergedBuffersUsed == static_cast<int>(m_mergedBuffers.size()))
+		{
+			DrawBuffer* buf					= new DrawBuffer();
+			Allocator*	persistent			= GetPersistentAllocator();
+			buf->vertexBuffer.m_allocator	= persistent;
+			buf->indexBuffer.m_allocator	= persistent;
+			buf->instanceBuffer.m_allocator = persistent;
+			m_mergedBuffers.push_back(buf);
 		}
 
-		if (!found)
+		DrawBuffer* buf	   = m_mergedBuffers[m_mergedBuffersUsed++];
+		buf->shapeType	   = lead.shapeType;
+		buf->textureHandle = lead.textureHandle;
+		buf->textureUV	   = lead.textureUV;
+		buf->clip		   = lead.clip;
+		buf->userData	   = lead.userData;
+		buf->drawOrder	   = lead.drawOrder;
+		buf->uid		   = lead.uid;
+		buf->vertexBuffer.shrink(0);
+		buf->indexBuffer.shrink(0);
+		buf->instanceBuffer.shrink(0);
+		return buf;
+	}
+
+	void BufferStoreData::TrimMergedBuffers()
+	{
+		for (DrawBuffer* buf : m_mergedBuffers)
 		{
-			m_drawOrders.push_back(drawOrder);
-			Utility::QuickSortArray<int>(m_drawOrders, 0, m_drawOrders.m_size - 1);
+			TrimToHighWater(buf->vertexBuffer, buf->vertexHighWater, 0);
+			TrimToHighWater(buf->indexBuffer, buf->indexHighWater, 0);
+			TrimToHighWater(buf->instanceBuffer, buf->instanceHighWater, 0);
 		}
+
+		m_mergedBuffersUsed = 0;
+	}
+
+	void BufferStoreData::ClearMergedBuffers()
+	{
+		for (DrawBuffer* buf : m_mergedBuffers)
+			delete buf;
+
+		m_mergedBuffers.clear();
+		m_mergedBuffersUsed = 0;
+	}
+
+	bool BufferStoreData::IsDrawStateMatching(const DrawBuffer& a, const DrawBuffer& b) const
+	{
+		return a.shapeType == b.shapeType && a.userData == b.userData && a.clip == b.clip && a.textureHandle == b.textureHandle && Math::IsEqual(a.textureUV, b.textureUV) && a.uid == b.uid;
+	}
+
+	void BufferStoreData::PackFrameArena()
+	{
+		int totalVertices = 0;
+		int totalIndices  = 0;
+
+		for (int i = 0; i < m_drawCommands.m_size; i++)
+		{
+			DrawBuffer& buf	 = *m_drawCommands[i];
+			buf.vertexOffset = totalVertices;
+			buf.vertexCount	 = buf.vertexBuffer.m_size;
+			buf.indexOffset	 = totalIndices;
+			buf.indexCount	 = buf.indexBuffer.m_size;
+			totalVertices += buf.vertexCount;
+			totalIndices += buf.indexCount;
+		}
+
+		m_frameVertices.resize(totalVertices);
+		m_frameIndices.resize(totalIndices);
+
+		// Indices stay relative to each buffer's first vertex, backends draw them with vertexOffset as the base vertex.
+		for (int i = 0; i < m_drawCommands.m_size; i++)
+		{
+			const DrawBuffer& buf = *m_drawCommands[i];
+			LINAVG_MEMCPY(m_frameVertices.m_data + buf.vertexOffset, buf.vertexBuffer.m_data, static_cast<size_t>(buf.vertexCount) * sizeof(Vertex));
+			LINAVG_MEMCPY(m_frameIndices.m_data + buf.indexOffset, buf.indexBuffer.m_data, static_cast<size_t>(buf.indexCount) * sizeof(Index));
+		}
+	}
+
+	int BufferStoreData::GetBufferIndexInDefaultArray(DrawBuffer* buf)
+	{
+		if (buf < m_defaultBuffers.m_data || buf >= m_defaultBuffers.m_data + m_defaultBuffers.m_size)
+			return -1;
+
+		return static_cast<int>(buf - m_defaultBuffers.m_data);
 	}
 
 } // namespace LinaVG
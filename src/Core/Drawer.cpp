@@ -37,111 +37,910 @@ OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "LinaVG/Core/BufferStore.hpp"
 #include "LinaVG/Core/Text.hpp"
 #include "LinaVG/Utility/Utility.hpp"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <cmath>
+#include <cstring>
 
 namespace LinaVG
 {
 
 	namespace
 	{
-		void New_CalculateVertexUVs(DrawBuffer* buf, int startIndex, int endIndex, const Vec2& bbMin, const Vec2& bbMax)
+		// Upper bound of worker contexts a deferred Drawer tessellates into.
+		constexpr int DEFERRED_MAX_CHUNKS = 16;
+
+		// Subdivision depth bezier flattening stops at, up to 1024 segments per curve.
+		constexpr int BEZIER_MAX_DEPTH = 10;
+
+		// Upper bound of chunks a polyline is stroked in parallel in.
+		constexpr int LINE_MAX_CHUNKS = 64;
+
+		// Segments stroked before each chunk to join its first segment. Joints mostly depend on corners moved by the previous ones,
+		// vertex averaged & parallel joints don't, so a chunk matches serial stroking if one of these is among its warmup segments.
+		constexpr int LINE_CHUNK_WARMUP = 32;
+
+		inline uint64_t HashVec2(uint64_t hash, const Vec2& v)
+		{
+			return Utility::HashCombine(hash, Utility::HashFloat(v.x) | (Utility::HashFloat(v.y) << 32));
+		}
+
+		inline uint64_t HashVec4(uint64_t hash, const Vec4& v)
+		{
+			hash = Utility::HashCombine(hash, Utility::HashFloat(v.x) | (Utility::HashFloat(v.y) << 32));
+			return Utility::HashCombine(hash, Utility::HashFloat(v.z) | (Utility::HashFloat(v.w) << 32));
+		}
+
+		inline uint64_t HashGrad(uint64_t hash, const Vec4Grad& grad)
+		{
+			hash = HashVec4(hash, grad.start);
+			hash = HashVec4(hash, grad.end);
+			return Utility::HashCombine(hash, static_cast<uint64_t>(grad.gradientType));
+		}
+
+		uint64_t HashStyle(uint64_t hash, const StyleOptions& style)
+		{
+			hash = HashGrad(hash, style.color);
+			hash = Utility::HashCombine(hash, Utility::HashFloat(style.thickness.start) | (Utility::HashFloat(style.thickness.end) << 32));
+			hash = Utility::HashCombine(hash, Utility::HashFloat(style.rounding) | (Utility::HashFloat(style.aaMultiplier) << 32));
+			hash = Utility::HashCombine(hash, static_cast<uint64_t>(style.aaEnabled) | (static_cast<uint64_t>(style.isFilled) << 1));
+
+			for (int i = 0; i < style.onlyRoundTheseCorners.m_size; i++)
+				hash = Utility::HashCombine(hash, static_cast<uint64_t>(style.onlyRoundTheseCorners[i]));
+
+			const OutlineOptions& outline = style.outlineOptions;
+			hash						  = Utility::HashCombine(hash, Utility::HashFloat(outline.thickness) | (static_cast<uint64_t>(outline.drawDirection) << 32));
+			hash						  = HashGrad(hash, outline.color);
+			hash						  = Utility::HashCombine(hash, static_cast<uint64_t>(reinterpret_cast<uintptr_t>(outline.textureHandle)));
+			hash						  = HashVec4(hash, outline.textureTilingAndOffset);
+
+			hash = Utility::HashCombine(hash, static_cast<uint64_t>(reinterpret_cast<uintptr_t>(style.textureHandle)));
+			hash = HashVec4(hash, style.textureTilingAndOffset);
+			hash = Utility::HashCombine(hash, static_cast<uint64_t>(reinterpret_cast<uintptr_t>(style.userData)));
+			return Utility::HashCombine(hash, style.uniqueID);
+		}
+
+		uint64_t HashTextOptions(uint64_t hash, const TextOptions& opts)
+		{
+			hash = Utility::HashCombine(hash, static_cast<uint64_t>(reinterpret_cast<uintptr_t>(opts.font)));
+			hash = HashGrad(hash, opts.color);
+			hash = Utility::HashCombine(hash, static_cast<uint64_t>(opts.alignment) | (static_cast<uint64_t>(opts.wordWrap) << 32));
+			hash = Utility::HashCombine(hash, Utility::HashFloat(opts.textScale) | (Utility::HashFloat(opts.spacing) << 32));
+			hash = Utility::HashCombine(hash, Utility::HashFloat(opts.newLineSpacing) | (Utility::HashFloat(opts.wrapWidth) << 32));
+			hash = HashVec4(hash, opts.cpuClipping);
+			hash = Utility::HashCombine(hash, static_cast<uint64_t>(reinterpret_cast<uintptr_t>(opts.userData)));
+			return Utility::HashCombine(hash, opts.uniqueID);
+		}
+
+		// Whether laying out text at a scale equals scaling its unit scale layout, so the cache can apply textScale on replay.
+		bool IsTextLayoutScalable(const TextOptions& opts)
+		{
+			return opts.alignment == TextAlignment::Left && Math::IsEqualMarg(opts.wrapWidth, 0.0f) && opts.spacing == 0.0f && opts.newLineSpacing == 0.0f;
+		}
+
+		// Fills the style part of a ShapeInstance, returns false if the style needs tessellation.
+		bool FillInstanceStyle(ShapeInstance& instance, const StyleOptions& style)
+		{
+			const OutlineOptions& outline	 = style.outlineOptions;
+			const bool			  hasOutline = !Math::IsEqualMarg(outline.thickness, 0.0f);
+
+			if (style.textureHandle != NULL_TEXTURE)
+				return false;
+
+			const bool outlineGradient = outline.color.gradientType != GradientType::None && !Math::IsEqual(outline.color.start, outline.color.end);
+			if (hasOutline && (outline.drawDirection != OutlineDrawDirection::Outwards || outline.textureHandle != NULL_TEXTURE || outlineGradient))
+				return false;
+
+			instance.colorStart		  = style.color.start;
+			instance.colorEnd		  = style.color.end;
+			instance.gradientType	  = style.color.gradientType;
+			instance.thickness		  = style.isFilled ? 0.0f : style.thickness.start;
+			instance.outlineThickness = hasOutline ? outline.thickness : 0.0f;
+			instance.outlineColor	  = outline.color.start;
+			instance.aaThickness	  = style.aaEnabled ? style.aaMultiplier * Config.globalAAMultiplier : 0.0f;
+			return true;
+		}
+
+		// Segments an arc of arcAngle degrees is split into so that none strays more than Config.flatnessTolerance from it.
+		int GetToleranceSegments(float radius, float arcAngle, int minSegments, int maxSegments)
+		{
+			const float step = Math::GetFlatnessAngle(radius, Config.flatnessTolerance);
+			return Math::Clamp(static_cast<int>(std::ceil(arcAngle / step)), minSegments, maxSegments);
+		}
+
+		// Segments a full circle is split into, segments <= 0 picks them from Config.flatnessTolerance or defaults to 36.
+		int GetCircleSegments(float radius, int segments)
 		{
-			for (int i = startIndex; i < endIndex; i++)
+			if (segments <= 0)
+				segments = Config.flatnessTolerance > 0.0f ? GetToleranceSegments(radius, 360.0f, 6, 180) : 36;
+
+			return Math::Clamp(segments, 6, 180);
+		}
+
+		// Vertices a convex fill pushes for a perimeter of that many points, filled shapes add a center, outlined ones extrude a second ring.
+		inline int GetFillVertexCount(int perimeter, bool isFilled)
+		{
+			return isFilled ? perimeter + 1 : perimeter * 2;
+		}
+
+		// Tolerance curves are flattened within, from the 0-100 smoothness of DrawBezier, negative picking it from Config.flatnessTolerance.
+		float GetCurveTolerance(int segments)
+		{
+			if (segments < 0 && Config.flatnessTolerance > 0.0f)
+				return Config.flatnessTolerance;
+
+			const float acc = static_cast<float>(segments < 0 ? 50 : Math::Clamp(segments, 1, 100));
+			return Math::Remap(acc, 1.0f, 100.0f, 1.0f, 0.02f);
+		}
+
+		// Appends the points of a cubic bezier, p0 excluded, splitting it in halves until its control points are within tolerance of the chord.
+		// The first split always happens, so lines drawn from the points get at least 3 of them.
+		void FlattenBezier(Array<Vec2>& points, const Vec2& p0, const Vec2& p1, const Vec2& p2, const Vec2& p3, float tolerance, int depth)
+		{
+			const float dx		 = p3.x - p0.x;
+			const float dy		 = p3.y - p0.y;
+			const float chordSqr = dx * dx + dy * dy;
+			bool		isFlat	 = false;
+
+			// The curve strays at most 3/4 of its farthest control point's distance from the chord, 3 * t * (1 - t) peaking at 3/4.
+			if (chordSqr < 1e-6f)
+			{
+				// Closed loop, measured against p0 instead of the chord.
+				const Vec2	d1	= Vec2(p1.x - p0.x, p1.y - p0.y);
+				const Vec2	d2	= Vec2(p2.x - p0.x, p2.y - p0.y);
+				const float max = Math::Max(d1.x * d1.x + d1.y * d1.y, d2.x * d2.x + d2.y * d2.y);
+				isFlat			= max * 0.5625f <= tolerance * tolerance;
+			}
+			else
+			{
+				// Cross products are the control points' distances to the chord, times its length.
+				const float d1	= Math::Abs((p1.x - p3.x) * dy - (p1.y - p3.y) * dx);
+				const float d2	= Math::Abs((p2.x - p3.x) * dy - (p2.y - p3.y) * dx);
+				const float max = Math::Max(d1, d2) * 0.75f;
+				isFlat			= max * max <= tolerance * tolerance * chordSqr;
+			}
+
+			if (depth == BEZIER_MAX_DEPTH || (depth > 0 && isFlat))
 			{
-				Vertex& vertex = buf->vertexBuffer[i];
-				vertex.uv.x	   = Math::Remap(vertex.pos.x, bbMin.x, bbMax.x, 0.0f, 1.0f);
-				vertex.uv.y	   = Math::Remap(vertex.pos.y, bbMin.y, bbMax.y, 0.0f, 1.0f);
+				points.push_back(p3);
+				return;
 			}
+
+			// De Casteljau at t = 0.5.
+			const Vec2 p01	 = Vec2((p0.x + p1.x) * 0.5f, (p0.y + p1.y) * 0.5f);
+			const Vec2 p12	 = Vec2((p1.x + p2.x) * 0.5f, (p1.y + p2.y) * 0.5f);
+			const Vec2 p23	 = Vec2((p2.x + p3.x) * 0.5f, (p2.y + p3.y) * 0.5f);
+			const Vec2 p012	 = Vec2((p01.x + p12.x) * 0.5f, (p01.y + p12.y) * 0.5f);
+			const Vec2 p123	 = Vec2((p12.x + p23.x) * 0.5f, (p12.y + p23.y) * 0.5f);
+			const Vec2 p0123 = Vec2((p012.x + p123.x) * 0.5f, (p012.y + p123.y) * 0.5f);
+			FlattenBezier(points, p0, p01, p012, p0123, tolerance, depth + 1);
+			FlattenBezier(points, p0123, p123, p23, p3, tolerance, depth + 1);
 		}
 
-		void New_CalculateVertexColors(DrawBuffer* buf, int startIndex, int endIndex, const Vec4Grad& color)
+		// Segments of the half circle GetArcPoints fits between two points of a rounded triangle corner.
+		float GetCornerArcSegments(float radius)
 		{
-			for (int i = startIndex; i < endIndex; i++)
-			{
-				Vertex& vertex = buf->vertexBuffer[i];
+			if (Config.flatnessTolerance <= 0.0f)
+				return 36.0f;
 
-				if (color.gradientType == GradientType::None)
-					vertex.col = color.start;
-				else if (color.gradientType == GradientType::Horizontal)
-					vertex.col = Math::Lerp(color.start, color.end, vertex.uv.x);
-				else
-					vertex.col = Math::Lerp(color.start, color.end, vertex.uv.y);
+			return static_cast<float>(GetToleranceSegments(radius, 180.0f, 2, 180));
+		}
+
+		float GetCornerArcSegments(const Vec2& p1, const Vec2& p2)
+		{
+			return GetCornerArcSegments(Math::Mag(Vec2(p2.x - p1.x, p2.y - p1.y)) / 2.0f);
+		}
+
+		// Pushes a triangle of vertices relative to base.
+		inline void PushTriangle(DrawBuffer* buf, int base, int i0, int i1, int i2)
+		{
+			buf->PushIndex(static_cast<Index>(base + i0));
+			buf->PushIndex(static_cast<Index>(base + i1));
+			buf->PushIndex(static_cast<Index>(base + i2));
+		}
+
+		// Vertex colors may be packed, see LINAVG_VERTEX_COLOR_RGBA8, so channels are changed via Vec4.
+		inline Vec4 WithAlpha(Vec4 col, float alpha)
+		{
+			col.w = alpha;
+			return col;
+		}
+
+		// Whether a segment starts from the same corners, bit by bit, & skips the same outline indices.
+		bool IsSameLineEntry(const LineSegment& a, const LineSegment& b)
+		{
+			for (int i = 0; i < 4; i++)
+			{
+				if (std::memcmp(&a.m_corners[i].pos, &b.m_corners[i].pos, sizeof(Vec2)) != 0)
+					return false;
 			}
+
+			return a.m_skipUpperStart == b.m_skipUpperStart && a.m_skipLowerStart == b.m_skipLowerStart;
 		}
+	} // namespace
 
-		void New_CalculateVertexUVsAndColor(DrawBuffer* buf, int startIndex, int endIndex, const Vec2& bbMin, const Vec2& bbMax, const Vec4Grad& color, bool preserveAlpha = false)
+	// Threads a Drawer runs parallel work on if Config.parallelFor isn't set. They sleep between runs and live as long as the Drawer.
+	class TaskPool
+	{
+	public:
+		TaskPool(int threadCount)
+		{
+			m_threads.reserve(threadCount);
+
+			for (int i = 0; i < threadCount; i++)
+				m_threads.emplace_back([this]() { WorkerLoop(); });
+		}
+
+		~TaskPool()
 		{
-			for (int i = startIndex; i < endIndex; i++)
 			{
-				Vertex& vertex = buf->vertexBuffer[i];
-				vertex.uv.x	   = Math::Remap(vertex.pos.x, bbMin.x, bbMax.x, 0.0f, 1.0f);
-				vertex.uv.y	   = Math::Remap(vertex.pos.y, bbMin.y, bbMax.y, 0.0f, 1.0f);
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_stop = true;
+			}
 
-				const float alpha = vertex.col.w;
+			m_wake.notify_all();
 
-				if (color.gradientType == GradientType::None)
-					vertex.col = color.start;
-				else if (color.gradientType == GradientType::Horizontal)
-					vertex.col = Math::Lerp(color.start, color.end, vertex.uv.x);
-				else
-					vertex.col = Math::Lerp(color.start, color.end, vertex.uv.y);
+			for (auto& thread : m_threads)
+				thread.join();
+		}
 
-				if (preserveAlpha)
-					vertex.col.w = alpha;
+		void Run(int taskCount, const std::function<void(int taskIndex)>& task)
+		{
+			{
+				// Workers still leaving the previous run would otherwise claim tasks of this one.
+				std::unique_lock<std::mutex> lock(m_mutex);
+				m_idle.wait(lock, [this]() { return m_active == 0; });
+				m_task		= &task;
+				m_taskCount = taskCount;
+				m_next.store(0);
+				m_generation++;
 			}
+
+			m_wake.notify_all();
+			RunTasks(task, taskCount);
+
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_idle.wait(lock, [this]() { return m_active == 0; });
+			m_task = nullptr;
 		}
 
-		void New_GetConvexBB(DrawBuffer* buf, int startIndex, int endIndex, Vec2& outMin, Vec2& outMax)
+	private:
+		void RunTasks(const std::function<void(int taskIndex)>& task, int taskCount)
 		{
-			outMin = Vec2(99999, 99999);
-			outMax = Vec2(-99999, -99999);
+			for (int i = m_next.fetch_add(1); i < taskCount; i = m_next.fetch_add(1))
+				task(i);
+		}
 
-			for (int i = startIndex; i < endIndex; i++)
+		void WorkerLoop()
+		{
+			uint64_t seenGeneration = 0;
+
+			while (true)
 			{
-				Vertex& vertex = buf->vertexBuffer[i];
+				const std::function<void(int taskIndex)>* task	= nullptr;
+				int										  count = 0;
+
+				{
+					std::unique_lock<std::mutex> lock(m_mutex);
+					m_wake.wait(lock, [&]() { return m_stop || (m_generation != seenGeneration && m_task != nullptr); });
+
+					if (m_stop)
+						return;
+
+					seenGeneration = m_generation;
+					task		   = m_task;
+					count		   = m_taskCount;
+					m_active++;
+				}
+
+				RunTasks(*task, count);
+
+				{
+					std::lock_guard<std::mutex> lock(m_mutex);
+					m_active--;
+				}
 
-				if (vertex.pos.x < outMin.x)
-					outMin.x = vertex.pos.x;
-				else if (vertex.pos.x > outMax.x)
-					outMax.x = vertex.pos.x;
-				if (vertex.pos.y < outMin.y)
-					outMin.y = vertex.pos.y;
-				else if (vertex.pos.y > outMax.y)
-					outMax.y = vertex.pos.y;
+				m_idle.notify_all();
 			}
 		}
-	} // namespace
+
+		LINAVG_VEC<std::thread>					  m_threads;
+		std::mutex								  m_mutex;
+		std::condition_variable					  m_wake;
+		std::condition_variable					  m_idle;
+		const std::function<void(int taskIndex)>* m_task	   = nullptr;
+		std::atomic<int>						  m_next	   = {0};
+		uint64_t								  m_generation = 0;
+		int										  m_taskCount  = 0;
+		int										  m_active	   = 0;
+		bool									  m_stop	   = false;
+	};
 
 	void Drawer::DrawBezier(const Vec2& p0, const Vec2& p1, const Vec2& p2, const Vec2& p3, StyleOptions& style, LineCapDirection cap, LineJointType jointType, int drawOrder, int segments)
 	{
-		float		acc		 = (float)Math::Clamp(segments, 0, 100);
-		const float increase = Math::Remap(acc, 0.0f, 100.0f, 0.15f, 0.01f);
-		Array<Vec2> points;
+		if (m_deferred || IsShapeCacheable(style.uniqueID))
+		{
+			DeferredCommand& cmd = RecordDeferred(DeferredCommandType::Bezier, 0.0f, drawOrder);
+			cmd.optionsIndex	 = RecordDeferredStyle(style);
+			cmd.points[0]		 = p0;
+			cmd.points[1]		 = p1;
+			cmd.points[2]		 = p2;
+			cmd.points[3]		 = p3;
+			cmd.ints[0]			 = static_cast<int>(cap);
+			cmd.ints[1]			 = static_cast<int>(jointType);
+			cmd.ints[2]			 = segments;
+			FinishRecord();
+			return;
+		}
+
+		// Flattened into storage reused across calls, DrawLines reads the points more than once when it splits them over buffers or strokes chunks in parallel.
+		m_curvePoints.shrink(0);
+		m_curvePoints.push_back(p0);
+		FlattenBezier(m_curvePoints, p0, p1, p2, p3, GetCurveTolerance(segments), 0);
+		DrawLines(m_curvePoints.m_data, m_curvePoints.m_size, style, cap, jointType, drawOrder);
+	}
+
+	void Drawer::DrawQuadBezier(const Vec2& p0, const Vec2& p1, const Vec2& p2, StyleOptions& style, LineCapDirection cap, LineJointType jointType, int drawOrder, int segments)
+	{
+		if (m_deferred || IsShapeCacheable(style.uniqueID))
+		{
+			DeferredCommand& cmd = RecordDeferred(DeferredCommandType::QuadBezier, 0.0f, drawOrder);
+			cmd.optionsIndex	 = RecordDeferredStyle(style);
+			cmd.points[0]		 = p0;
+			cmd.points[1]		 = p1;
+			cmd.points[2]		 = p2;
+			cmd.ints[0]			 = static_cast<int>(cap);
+			cmd.ints[1]			 = static_cast<int>(jointType);
+			cmd.ints[2]			 = segments;
+			FinishRecord();
+			return;
+		}
+
+		// Degree elevated to the exact same cubic.
+		const Vec2 c1 = Vec2(p0.x + (p1.x - p0.x) * 2.0f / 3.0f, p0.y + (p1.y - p0.y) * 2.0f / 3.0f);
+		const Vec2 c2 = Vec2(p2.x + (p1.x - p2.x) * 2.0f / 3.0f, p2.y + (p1.y - p2.y) * 2.0f / 3.0f);
+
+		m_curvePoints.shrink(0);
+		m_curvePoints.push_back(p0);
+		FlattenBezier(m_curvePoints, p0, c1, c2, p2, GetCurveTolerance(segments), 0);
+		DrawLines(m_curvePoints.m_data, m_curvePoints.m_size, style, cap, jointType, drawOrder);
+	}
+
+	void Drawer::DrawArc(const Vec2& center, float radius, float startAngle, float endAngle, StyleOptions& style, LineCapDirection cap, LineJointType jointType, int drawOrder, int segments)
+	{
+		if (m_deferred || IsShapeCacheable(style.uniqueID))
+		{
+			DeferredCommand& cmd = RecordDeferred(DeferredCommandType::Arc, 0.0f, drawOrder);
+			cmd.optionsIndex	 = RecordDeferredStyle(style);
+			cmd.points[0]		 = center;
+			cmd.floats[0]		 = radius;
+			cmd.floats[1]		 = startAngle;
+			cmd.floats[2]		 = endAngle;
+			cmd.ints[0]			 = static_cast<int>(cap);
+			cmd.ints[1]			 = static_cast<int>(jointType);
+			cmd.ints[2]			 = segments;
+			FinishRecord();
+			return;
+		}
+
+		if (endAngle <= startAngle)
+			endAngle += 360.0f;
+
+		// At least 2 segments, lines need 3 points.
+		const float span		  = Math::Min(endAngle - startAngle, 360.0f);
+		const int	arcSegments	  = Math::Max(static_cast<int>(std::ceil(span * static_cast<float>(GetCircleSegments(radius, segments)) / 360.0f)), 2);
+		const float angleIncrease = span / static_cast<float>(arcSegments);
+
+		ArcStepper arc(center, radius, startAngle, angleIncrease);
+		m_curvePoints.shrink(0);
 
-		bool addLast = true;
-		for (float t = 0.0f; t < 1.0f; t += increase)
+		for (int i = 0; i <= arcSegments; i++)
+			m_curvePoints.push_back(arc.Next());
+
+		DrawLines(m_curvePoints.m_data, m_curvePoints.m_size, style, cap, jointType, drawOrder);
+	}
+
+	Drawer::~Drawer()
+	{
+		for (Drawer* worker : m_deferredWorkers)
+			delete worker;
+
+		for (LineChunk* chunk : m_lineChunks)
+			delete chunk;
+
+		for (auto& [uid, group] : m_shapeCache)
 		{
-			points.push_back(Math::SampleBezier(p0, p1, p2, p3, t));
+			for (ShapeCache* cache : group.entries)
+				delete cache;
+		}
 
-			if (Math::IsEqualMarg(t, 1.0f, 0.001f))
-				addLast = false;
+		delete m_taskPool;
+		m_deferredWorkers.clear();
+		m_lineChunks.clear();
+	}
+
+	void Drawer::RunParallel(int taskCount, const std::function<void(int taskIndex)>& task)
+	{
+		if (Config.parallelFor)
+		{
+			Config.parallelFor(taskCount, task);
+			return;
 		}
 
-		if (addLast)
-			points.push_back(Math::SampleBezier(p0, p1, p2, p3, 1.0f));
+		if (m_taskPool == nullptr)
+			m_taskPool = new TaskPool(Math::Max(0, static_cast<int>(std::thread::hardware_concurrency()) - 1));
 
-		/*
-		const Vec4ui& clip = m_bufferStore.GetData().m_clipRect;
-		if (clip.z != 0 || clip.w != 0)
+		m_taskPool->Run(taskCount, task);
+	}
+
+	void Drawer::SetAllocator(Allocator* allocator)
+	{
+		m_bufferStore.SetAllocator(allocator);
+
+		Allocator* persistent = m_bufferStore.GetData().GetPersistentAllocator();
+		m_deferredCommands.clear();
+		m_deferredPoints.clear();
+		m_deferredText.clear();
+		m_deferredStyles.clear();
+		m_deferredTextOptions.clear();
+		m_deferredCommands.m_allocator = persistent;
+		m_deferredPoints.m_allocator   = persistent;
+		m_deferredText.m_allocator	   = persistent;
+	}
+
+	TextCacheStats Drawer::GetTextCacheStats() const
+	{
+		TextCacheStats stats;
+
+		auto add = [&stats](const BufferStoreData& data) {
+			stats.hits += data.m_textCacheStats.hits;
+			stats.misses += data.m_textCacheStats.misses;
+			stats.evictions += data.m_textCacheStats.evictions;
+			stats.bytes += data.m_textCacheBytes;
+			stats.entries += static_cast<int>(data.m_textCache.size());
+		};
+
+		add(m_bufferStore.GetData());
+
+		for (Drawer* worker : m_deferredWorkers)
+			add(worker->m_bufferStore.GetData());
+
+		return stats;
+	}
+
+	void Drawer::BeginDrawList(DrawList& list)
+	{
+		if (m_drawList != nullptr)
 		{
-			Vec2 min = {}, max = {};
-			GetConvexBoundingBox(&points[0], points.m_size, min, max);
-			if (!clip.IsPointInside(min) && !clip.IsPointInside(max))
+			if (Config.errorCallback)
+				Config.errorCallback("LinaVG: Can't begin a draw list while recording another one!");
+			return;
+		}
+
+		list.Clear();
+		m_drawList		   = &list;
+		m_drawListDeferred = m_deferred;
+		m_deferred		   = false;
+	}
+
+	void Drawer::EndDrawList()
+	{
+		m_drawList = nullptr;
+		m_deferred = m_drawListDeferred;
+	}
+
+	void Drawer::ReplayDrawList(const DrawList& list, const Vec2& translation, int drawOrderOffset)
+	{
+		if (m_deferred)
+		{
+			DeferredCommand& cmd = RecordDeferred(DeferredCommandType::DrawList, 0.0f, drawOrderOffset);
+			cmd.optionsIndex	 = static_cast<int>(m_deferredDrawLists.size());
+			cmd.points[0]		 = translation;
+			m_deferredDrawLists.push_back(&list);
+			return;
+		}
+
+		AppendBuffers(list.m_data.m_defaultBuffers, translation, drawOrderOffset);
+	}
+
+	void Drawer::AppendBuffers(const Array<DrawBuffer>& buffers, const Vec2& translation, int drawOrderOffset)
+	{
+		BufferStoreData& data = GetRecordData();
+		const Vec4i		 clip = data.m_clipRect;
+		const bool		 move = translation.x != 0.0f || translation.y != 0.0f;
+
+		for (int i = 0; i < buffers.m_size; i++)
+		{
+			const DrawBuffer& src = buffers[i];
+
+			if (src.vertexBuffer.m_size == 0 && src.instanceBuffer.m_size == 0)
+				continue;
+
+			data.m_clipRect = src.clip;
+			if (src.clip.z != 0 || src.clip.w != 0)
+			{
+				data.m_clipRect.x += static_cast<int>(translation.x);
+				data.m_clipRect.y += static_cast<int>(translation.y);
+			}
+
+			DrawBuffer& dst		 = data.GetDefaultBuffer(src.userData, src.uid, src.drawOrder + drawOrderOffset, src.shapeType, src.textureHandle, src.textureUV, src.vertexBuffer.m_size);
+			const int	vtxBase	 = dst.vertexBuffer.m_size;
+			const int	instBase = dst.instanceBuffer.m_size;
+
+			if (move)
+			{
+				// Text is laid out on whole pixels, moving it by a fraction would blur the glyphs.
+				const bool isText = src.shapeType == DrawBufferShapeType::Text || src.shapeType == DrawBufferShapeType::SDFText;
+				const Vec2 offset = isText ? Vec2(static_cast<float>(Math::CustomRound(translation.x)), static_cast<float>(Math::CustomRound(translation.y))) : translation;
+
+				dst.vertexBuffer.resize(vtxBase + src.vertexBuffer.m_size);
+				Utility::TranslateVertices(dst.vertexBuffer.m_data + vtxBase, src.vertexBuffer.m_data, src.vertexBuffer.m_size, offset);
+			}
+			else
+				dst.PushVertices(src.vertexBuffer.m_data, src.vertexBuffer.m_size);
+
+			dst.PushIndices(src.indexBuffer.m_data, src.indexBuffer.m_size, vtxBase);
+			dst.instanceBuffer.append(src.instanceBuffer.m_data, src.instanceBuffer.m_size);
+
+			if (move)
+			{
+				for (int j = instBase; j < dst.instanceBuffer.m_size; j++)
+				{
+					dst.instanceBuffer[j].center.x += translation.x;
+					dst.instanceBuffer[j].center.y += translation.y;
+				}
+			}
+		}
+
+		data.m_clipRect = clip;
+	}
+
+	void Drawer::FlushBuffers()
+	{
+		FlushBuffers(nullptr, 0);
+	}
+
+	void Drawer::FlushBuffers(Drawer* const* contexts, int contextCount)
+	{
+		BufferStore* stores[LINAVG_MAX_RECORDING_CONTEXTS];
+		int			 storeCount = 0;
+
+		TessellateDeferred();
+
+		for (int i = 0; i < contextCount; i++)
+		{
+			Drawer* context = contexts[i];
+			context->TessellateDeferred();
+
+			if (storeCount < LINAVG_MAX_RECORDING_CONTEXTS - 1)
+				stores[storeCount++] = &context->m_bufferStore;
+			else if (Config.errorCallback)
+				Config.errorCallback("LinaVG: Too many recording contexts, extra contexts won't be drawn!");
+		}
+
+		m_bufferStore.FlushBuffers(stores, storeCount);
+	}
+
+	void Drawer::ResetFrame()
+	{
+		m_bufferStore.ResetFrame();
+
+		if (Config.shapeCachingEnabled)
+		{
+			m_shapeCacheFrame++;
+
+			// Release shapes that weren't drawn since the last sweep, and entries past the count drawn on the last frame.
+			if (Config.shapeCacheExpireInterval > 0 && m_shapeCacheFrame % Config.shapeCacheExpireInterval == 0)
+			{
+				for (auto it = m_shapeCache.begin(); it != m_shapeCache.end();)
+				{
+					ShapeCacheGroup& group	 = it->second;
+					const bool		 expired = m_shapeCacheFrame - group.frame > Config.shapeCacheExpireInterval;
+					const int		 keep	 = expired ? 0 : (group.frame == m_shapeCacheFrame - 1 ? group.drawCount : static_cast<int>(group.entries.size()));
+
+					for (int i = keep; i < static_cast<int>(group.entries.size()); i++)
+						delete group.entries[i];
+
+					group.entries.resize(keep);
+
+					if (expired)
+						it = m_shapeCache.erase(it);
+					else
+						++it;
+				}
+			}
+		}
+
+		for (int i = 0; i < m_deferredWorkersUsed; i++)
+			m_deferredWorkers[i]->ResetFrame();
+
+		m_deferredWorkersUsed = 0;
+		m_deferredCommands.shrink(0);
+		m_deferredPoints.shrink(0);
+		m_deferredText.shrink(0);
+		m_deferredStyles.clear();
+		m_deferredTextOptions.clear();
+		m_deferredDrawLists.clear();
+		m_deferredShapeCaches.clear();
+	}
+
+	DeferredCommand& Drawer::RecordDeferred(DeferredCommandType type, float rotateAngle, int drawOrder)
+	{
+		m_deferredCommands.emplace_back();
+		DeferredCommand& cmd = m_deferredCommands.last_ref();
+		cmd.type			 = type;
+		cmd.rotateAngle		 = rotateAngle;
+		cmd.drawOrder		 = drawOrder;
+		cmd.clip			 = GetRecordData().m_clipRect;
+		return cmd;
+	}
+
+	int Drawer::RecordDeferredStyle(const StyleOptions& style)
+	{
+		m_deferredStyles.push_back(style);
+		return static_cast<int>(m_deferredStyles.size()) - 1;
+	}
+
+	void Drawer::RecordDeferredPoints(DeferredCommand& cmd, const Vec2* points, int count)
+	{
+		cmd.dataOffset = m_deferredPoints.m_size;
+		cmd.dataCount  = count;
+
+		m_deferredPoints.append(points, count);
+	}
+
+	void Drawer::InvalidateShapeCache(uint64_t uid)
+	{
+		auto it = m_shapeCache.find(uid);
+		if (it != m_shapeCache.end())
+			it->second.version++;
+	}
+
+	void Drawer::InvalidateShapeCache()
+	{
+		for (auto& [uid, group] : m_shapeCache)
+			group.version++;
+	}
+
+	bool Drawer::IsShapeCacheable(uint64_t uid)
+	{
+		if (!Config.shapeCachingEnabled || uid == 0 || m_drawList != nullptr || m_deferredWorker)
+			return false;
+
+		// Internal overrides aren't part of the cached parameters.
+		const BufferStoreData& data = GetRecordData();
+		return !data.m_rectOverrideData.overrideRectPositions && !data.m_uvOverride.m_override;
+	}
+
+	void Drawer::FinishRecord()
+	{
+		const DeferredCommand cmd	 = m_deferredCommands.last_ref();
+		const bool			  isText = cmd.type == DeferredCommandType::Text;
+		const uint64_t		  uid	 = isText ? m_deferredTextOptions[cmd.optionsIndex].uniqueID : m_deferredStyles[cmd.optionsIndex].uniqueID;
+
+		// Deferred commands that don't go through the cache are tessellated as is.
+		if (!IsShapeCacheable(uid))
+			return;
+
+		uint32_t		version	  = 0;
+		ShapeCache&		cache	  = AcquireShapeCache(uid, version);
+		const uint64_t	paramHash = HashDeferredCommand(cmd);
+
+		if (!cache.recorded || cache.version != version || cache.paramHash != paramHash)
+		{
+			cache.version	= version;
+			cache.paramHash = paramHash;
+			cache.recorded	= true;
+
+			// Tessellated into the cache by the worker context at flush, it's replayed from there.
+			if (m_deferred)
+			{
+				m_deferredCommands.last_ref().cacheIndex = static_cast<int>(m_deferredShapeCaches.size());
+				m_deferredShapeCaches.push_back(&cache);
 				return;
-		}*/
+			}
+
+			BeginDrawList(cache.list);
+			ReplayDeferred(*this, cmd);
+			EndDrawList();
+		}
+
+		m_deferredCommands.shrink(m_deferredCommands.m_size - 1);
+
+		if (isText)
+		{
+			m_deferredText.shrink(cmd.dataOffset);
+			m_deferredTextOptions.pop_back();
+		}
+		else
+		{
+			m_deferredPoints.shrink(m_deferredPoints.m_size - cmd.dataCount);
+			m_deferredStyles.pop_back();
+		}
+
+		ReplayDrawList(cache.list);
+	}
+
+	ShapeCache& Drawer::AcquireShapeCache(uint64_t uid, uint32_t& version)
+	{
+		ShapeCacheGroup& group = m_shapeCache[uid];
+
+		if (group.frame != m_shapeCacheFrame)
+		{
+			group.frame		= m_shapeCacheFrame;
+			group.drawCount = 0;
+		}
 
-		DrawLines(&points[0], points.m_size, style, cap, jointType, drawOrder);
+		if (group.drawCount == static_cast<int>(group.entries.size()))
+			group.entries.push_back(new ShapeCache());
 
-		points.clear();
+		version = group.version;
+		return *group.entries[group.drawCount++];
+	}
+
+	uint64_t Drawer::HashDeferredCommand(const DeferredCommand& cmd) const
+	{
+		uint64_t hash = static_cast<uint64_t>(cmd.type);
+		hash		  = Utility::HashCombine(hash, static_cast<uint64_t>(static_cast<uint32_t>(cmd.drawOrder)));
+		hash		  = Utility::HashCombine(hash, Utility::HashFloat(cmd.rotateAngle));
+		hash		  = Utility::HashCombine(hash, static_cast<uint64_t>(static_cast<uint32_t>(cmd.clip.x)) | (static_cast<uint64_t>(static_cast<uint32_t>(cmd.clip.y)) << 32));
+		hash		  = Utility::HashCombine(hash, static_cast<uint64_t>(static_cast<uint32_t>(cmd.clip.z)) | (static_cast<uint64_t>(static_cast<uint32_t>(cmd.clip.w)) << 32));
+		hash		  = Utility::HashCombine(hash, Utility::HashFloat(Config.globalAAMultiplier) | (Utility::HashFloat(Config.miterLimit) << 32));
+		hash		  = Utility::HashCombine(hash, Utility::HashFloat(Config.flatnessTolerance));
+
+		for (int i = 0; i < 4; i++)
+			hash = HashVec2(hash, cmd.points[i]);
+
+		hash = HashVec4(hash, cmd.vectors[0]);
+		hash = HashVec4(hash, cmd.vectors[1]);
+
+		for (int i = 0; i < 3; i++)
+			hash = Utility::HashCombine(hash, Utility::HashFloat(cmd.floats[i]) | (static_cast<uint64_t>(static_cast<uint32_t>(cmd.ints[i])) << 32));
+
+		hash = Utility::HashCombine(hash, static_cast<uint64_t>(reinterpret_cast<uintptr_t>(cmd.textureHandle)));
+		hash = Utility::HashCombine(hash, static_cast<uint64_t>(cmd.flag));
+
+		if (cmd.type == DeferredCommandType::Text)
+		{
+			for (int i = 0; i < cmd.dataCount; i++)
+				hash = Utility::HashCombine(hash, static_cast<uint64_t>(static_cast<uint8_t>(m_deferredText[cmd.dataOffset + i])));
+
+			return HashTextOptions(hash, m_deferredTextOptions[cmd.optionsIndex]);
+		}
+
+		for (int i = 0; i < cmd.dataCount; i++)
+			hash = HashVec2(hash, m_deferredPoints[cmd.dataOffset + i]);
+
+		return HashStyle(hash, m_deferredStyles[cmd.optionsIndex]);
+	}
+
+	void Drawer::TessellateDeferred()
+	{
+		const int commandCount = m_deferredCommands.m_size;
+
+		if (commandCount == 0)
+			return;
+
+		// Chunking only depends on the command count, so the output is the same regardless of how tasks are scheduled.
+		int chunkSize = Config.deferredChunkSize < 1 ? 1 : Config.deferredChunkSize;
+		if ((commandCount + chunkSize - 1) / chunkSize > DEFERRED_MAX_CHUNKS)
+			chunkSize = (commandCount + DEFERRED_MAX_CHUNKS - 1) / DEFERRED_MAX_CHUNKS;
+
+		const int chunkCount = (commandCount + chunkSize - 1) / chunkSize;
+
+		while (static_cast<int>(m_deferredWorkers.size()) < chunkCount)
+		{
+			m_deferredWorkers.push_back(new Drawer());
+			m_deferredWorkers.back()->m_deferredWorker = true;
+		}
+
+		m_deferredWorkersUsed = Math::Max(m_deferredWorkersUsed, chunkCount);
+
+		auto task = [&](int chunk) {
+			Drawer*	  worker = m_deferredWorkers[chunk];
+			const int start	 = chunk * chunkSize;
+			const int end	 = start + chunkSize < commandCount ? start + chunkSize : commandCount;
+
+			for (int i = start; i < end; i++)
+				worker->ReplayDeferred(*this, m_deferredCommands[i]);
+
+			worker->SetClipRect(Vec4i(0, 0, 0, 0));
+		};
+
+		RunParallel(chunkCount, task);
+
+		// Copied in chunk order, buffers of the same state merge as if the commands were drawn right away.
+		for (int i = 0; i < chunkCount; i++)
+			AppendBuffers(m_deferredWorkers[i]->m_bufferStore.GetData().m_defaultBuffers, Vec2(0.0f, 0.0f), 0);
+
+		m_deferredCommands.shrink(0);
+		m_deferredPoints.shrink(0);
+		m_deferredText.shrink(0);
+		m_deferredStyles.clear();
+		m_deferredTextOptions.clear();
+		m_deferredDrawLists.clear();
+		m_deferredShapeCaches.clear();
+	}
+
+	void Drawer::ReplayDeferred(const Drawer& source, const DeferredCommand& cmd)
+	{
+		if (cmd.cacheIndex != -1)
+		{
+			DrawList&		list	 = source.m_deferredShapeCaches[cmd.cacheIndex]->list;
+			DeferredCommand uncached = cmd;
+			uncached.cacheIndex		 = -1;
+
+			BeginDrawList(list);
+			ReplayDeferred(source, uncached);
+			EndDrawList();
+			SetClipRect(cmd.clip);
+			ReplayDrawList(list);
+			return;
+		}
+
+		SetClipRect(cmd.clip);
+
+		if (cmd.type == DeferredCommandType::Text)
+		{
+#ifndef LINAVG_DISABLE_TEXT_SUPPORT
+			DrawTextDefault(&source.m_deferredText[cmd.dataOffset], cmd.points[0], source.m_deferredTextOptions[cmd.optionsIndex], cmd.rotateAngle, cmd.drawOrder, cmd.flag);
+#endif
+			return;
+		}
+
+		if (cmd.type == DeferredCommandType::DrawList)
+		{
+			ReplayDrawList(*source.m_deferredDrawLists[cmd.optionsIndex], cmd.points[0], cmd.drawOrder);
+			return;
+		}
+
+		if (cmd.type == DeferredCommandType::Image)
+		{
+			DrawImage(cmd.textureHandle, cmd.points[0], cmd.points[1], cmd.vectors[0], cmd.rotateAngle, cmd.drawOrder, cmd.vectors[1], cmd.points[2], cmd.points[3]);
+			return;
+		}
+
+		// Draw calls take non-const styles & points, but don't modify them.
+		StyleOptions& style	 = const_cast<StyleOptions&>(source.m_deferredStyles[cmd.optionsIndex]);
+		Vec2*		  points = cmd.dataCount == 0 ? nullptr : const_cast<Vec2*>(&source.m_deferredPoints[cmd.dataOffset]);
+
+		switch (cmd.type)
+		{
+		case DeferredCommandType::Bezier:
+			DrawBezier(cmd.points[0], cmd.points[1], cmd.points[2], cmd.points[3], style, static_cast<LineCapDirection>(cmd.ints[0]), static_cast<LineJointType>(cmd.ints[1]), cmd.drawOrder, cmd.ints[2]);
+			break;
+		case DeferredCommandType::QuadBezier:
+			DrawQuadBezier(cmd.points[0], cmd.points[1], cmd.points[2], style, static_cast<LineCapDirection>(cmd.ints[0]), static_cast<LineJointType>(cmd.ints[1]), cmd.drawOrder, cmd.ints[2]);
+			break;
+		case DeferredCommandType::Line:
+			DrawLine(cmd.points[0], cmd.points[1], style, static_cast<LineCapDirection>(cmd.ints[0]), cmd.rotateAngle, cmd.drawOrder);
+			break;
+		case DeferredCommandType::Lines:
+			DrawLines(points, cmd.dataCount, style, static_cast<LineCapDirection>(cmd.ints[0]), static_cast<LineJointType>(cmd.ints[1]), cmd.drawOrder);
+			break;
+		case DeferredCommandType::Triangle:
+			DrawTriangle(cmd.points[0], cmd.points[1], cmd.points[2], style, cmd.rotateAngle, cmd.drawOrder);
+			break;
+		case DeferredCommandType::Rect:
+			DrawRect(cmd.points[0], cmd.points[1], style, cmd.rotateAngle, cmd.drawOrder);
+			break;
+		case DeferredCommandType::NGon:
+			DrawNGon(cmd.points[0], cmd.floats[0], cmd.ints[0], style, cmd.rotateAngle, cmd.drawOrder);
+			break;
+		case DeferredCommandType::Convex:
+			DrawConvex(points, cmd.dataCount, style, cmd.rotateAngle, cmd.drawOrder);
+			break;
+		case DeferredCommandType::Circle:
+			DrawCircle(cmd.points[0], cmd.floats[0], style, cmd.ints[0], cmd.rotateAngle, cmd.floats[1], cmd.floats[2], cmd.drawOrder);
+			break;
+		case DeferredCommandType::Arc:
+			DrawArc(cmd.points[0], cmd.floats[0], cmd.floats[1], cmd.floats[2], style, static_cast<LineCapDirection>(cmd.ints[0]), static_cast<LineJointType>(cmd.ints[1]), cmd.drawOrder, cmd.ints[2]);
+			break;
+		default:
+			break;
+		}
 	}
 
 	void Drawer::DrawPoint(const Vec2& p1, const Vec4& col)
@@ -155,6 +954,17 @@ namespace LinaVG
 
 	void Drawer::DrawLine(const Vec2& p1, const Vec2& p2, StyleOptions& style, LineCapDirection cap, float rotateAngle, int drawOrder)
 	{
+		if (m_deferred || IsShapeCacheable(style.uniqueID))
+		{
+			DeferredCommand& cmd = RecordDeferred(DeferredCommandType::Line, rotateAngle, drawOrder);
+			cmd.optionsIndex	 = RecordDeferredStyle(style);
+			cmd.points[0]		 = p1;
+			cmd.points[1]		 = p2;
+			cmd.ints[0]			 = static_cast<int>(cap);
+			FinishRecord();
+			return;
+		}
+
 		SimpleLine	 l = CalculateSimpleLine(p1, p2, style);
 		StyleOptions s = StyleOptions(style);
 		s.isFilled	   = true;
@@ -185,6 +995,17 @@ namespace LinaVG
 			return;
 		}
 
+		if (m_deferred || IsShapeCacheable(opts.uniqueID))
+		{
+			DeferredCommand& cmd = RecordDeferred(DeferredCommandType::Lines, 0.0f, drawOrder);
+			cmd.optionsIndex	 = RecordDeferredStyle(opts);
+			cmd.ints[0]			 = static_cast<int>(cap);
+			cmd.ints[1]			 = static_cast<int>(jointType);
+			RecordDeferredPoints(cmd, points, count);
+			FinishRecord();
+			return;
+		}
+
 		/*const Vec4ui& clip = m_bufferStore.GetData().m_clipRect;
 		if (clip.z != 0 || clip.w != 0)
 		{
@@ -194,167 +1015,130 @@ namespace LinaVG
 				return;
 		}*/
 
-		// Generate line structs between each points.
-		// Each line struct will contain -> line vertices, upper & below vertices.
+		DrawLinesRange(points, count, 0, count - 1, opts, cap, jointType, drawOrder);
+	}
+
+	void Drawer::DrawLinesRange(Vec2* points, int count, int firstSegment, int endSegment, StyleOptions& opts, LineCapDirection cap, LineJointType jointType, int drawOrder)
+	{
 		StyleOptions style = StyleOptions(opts);
 		style.isFilled	   = true;
 
-		// Determine which buffer to use.
-		// Also correct the buffer pointer if getting a new buffer invalidated it.
-		DrawBuffer* destBuf = &m_bufferStore.GetData().GetDefaultBuffer(style.userData, style.uniqueID, drawOrder, DrawBufferShapeType::Shape, style.textureHandle, style.textureTilingAndOffset);
-
-		// Calculate the line points.
-		Array<Line*> lines;
-		lines.reserve(count - 1);
-		LineCapDirection usedCapDir = LineCapDirection::None;
-
-		for (int i = 0; i < count - 1; i++)
+		// Segments take at least 4 vertices, outlines extrude the perimeter which is at most all line vertices.
+		const int segmentCount	 = endSegment - firstSegment;
+		const int minVertexCount = segmentCount * 4;
+		if (minVertexCount * 2 > LINAVG_MAX_BUFFER_VERTICES && segmentCount > 3)
 		{
-			if (i == 0 && (cap == LineCapDirection::Left || cap == LineCapDirection::Both))
-				usedCapDir = LineCapDirection::Left;
-			else if (i == count - 2 && (cap == LineCapDirection::Right || cap == LineCapDirection::Both))
-				usedCapDir = LineCapDirection::Right;
-			else
-				usedCapDir = LineCapDirection::None;
+			DrawLinesSplit(points, count, firstSegment, endSegment, opts, cap, jointType, drawOrder);
+			return;
+		}
 
-			const float t		  = static_cast<float>(i) / static_cast<float>(count - 1);
-			const float t2		  = static_cast<float>(i + 1) / static_cast<float>(count - 1);
-			style.thickness.start = Math::Lerp(opts.thickness.start, opts.thickness.end, t);
-			style.thickness.end	  = Math::Lerp(opts.thickness.start, opts.thickness.end, t2);
+		const bool	addUpperLowerIndices	   = style.aaEnabled || !Math::IsEqualMarg(style.outlineOptions.thickness, 0.0f);
+		const bool	parallel				   = Config.parallelLineThreshold > 0 && segmentCount + 1 >= Config.parallelLineThreshold && !m_deferredWorker;
+		DrawBuffer* destBuf					   = &GetRecordData().GetDefaultBuffer(style.userData, style.uniqueID, drawOrder, DrawBufferShapeType::Shape, style.textureHandle, style.textureTilingAndOffset, minVertexCount);
+		int			drawBufferStartBeforeLines = destBuf->vertexBuffer.m_size;
+		int			indexStartBeforeLines	   = destBuf->indexBuffer.m_size;
+		int			lineVertexCount			   = 0;
 
-			Line* line = new Line();
-			CalculateLine(*line, points[i], points[i + 1], style, usedCapDir);
-			lines.push_back(line);
+		// Chunks are stroked into their own buffers, the same buffers are picked as for serial stroking below.
+		if (parallel)
+			lineVertexCount = StrokeLineChunks(points, count, firstSegment, endSegment, opts, cap, jointType, addUpperLowerIndices);
+		else
+		{
+			m_lineStroke.buf = destBuf;
+			StrokeLines(m_lineStroke, points, count, firstSegment, endSegment, false, opts, style, cap, jointType, addUpperLowerIndices);
+			lineVertexCount = destBuf->vertexBuffer.m_size - drawBufferStartBeforeLines;
 		}
 
-		// Calculate line joints.
-		for (int i = 0; i < lines.m_size - 1; i++)
+		// Caps & joints add up to more than the lower bound, the exact count is only known once stroked.
+		const bool split = lineVertexCount * 2 > LINAVG_MAX_BUFFER_VERTICES && segmentCount > 3;
+		if (split || lineVertexCount > LINAVG_MAX_BUFFER_VERTICES - drawBufferStartBeforeLines)
 		{
-			Line* curr = lines[i];
-			Line* next = lines[i + 1];
+			destBuf->vertexBuffer.shrink(drawBufferStartBeforeLines);
+			destBuf->indexBuffer.shrink(indexStartBeforeLines);
 
-			const Vec2 currDir = Math::Normalized(Vec2(curr->m_vertices[2].pos.x - curr->m_vertices[3].pos.x, curr->m_vertices[2].pos.y - curr->m_vertices[3].pos.y));
-			const Vec2 nextDir = Math::Normalized(Vec2(next->m_vertices[2].pos.x - next->m_vertices[3].pos.x, next->m_vertices[2].pos.y - next->m_vertices[3].pos.y));
-
-			if (!Math::AreLinesParallel(curr->m_vertices[3].pos, curr->m_vertices[2].pos, next->m_vertices[3].pos, next->m_vertices[2].pos))
+			if (split)
 			{
-				// If next line is going below current one, angle is positive, and we merge lower vertices while joining upper.
-				// Vice versa if angle is negative
-				const float angle = Math::GetAngleBetweenDirs(currDir, nextDir);
-
-				LineJointType usedJointType = jointType;
-
-				if (jointType != LineJointType::VtxAverage)
-				{
-					if (Math::Abs(angle) < 15.0f)
-						usedJointType = LineJointType::VtxAverage;
-					else
-					{
-						// Joint type fallbacks.
-						if (jointType == LineJointType::Miter && Math::Abs(angle) > Config.miterLimit)
-							usedJointType = LineJointType::BevelRound;
-
-						if (jointType == LineJointType::BevelRound && Math::IsEqualMarg(style.rounding, 0.0f))
-							usedJointType = LineJointType::Bevel;
-					}
-				}
-
-				JoinLines(*curr, *next, style, usedJointType, angle < 0.0f);
-			}
-			else
-			{
-				next->m_upperIndices.erase(next->m_upperIndices.findAddr(0));
-				next->m_lowerIndices.erase(next->m_lowerIndices.findAddr(3));
+				DrawLinesSplit(points, count, firstSegment, endSegment, opts, cap, jointType, drawOrder);
+				return;
 			}
-		}
 
-		const int drawBufferStartBeforeLines = destBuf->vertexBuffer.m_size;
+			// Overflowed the buffer picked for the lower bound, stroke again into one it fits in.
+			destBuf					   = &GetRecordData().GetDefaultBuffer(style.userData, style.uniqueID, drawOrder, DrawBufferShapeType::Shape, style.textureHandle, style.textureTilingAndOffset, lineVertexCount);
+			drawBufferStartBeforeLines = destBuf->vertexBuffer.m_size;
 
-		// Actually draw the lines after all calculations are done & corrected.
-		for (int i = 0; i < lines.m_size; i++)
-		{
-			int destBufStart = destBuf->vertexBuffer.m_size;
-			for (int j = 0; j < lines[i]->m_vertices.m_size; j++)
-			{
-				destBuf->PushVertex(lines[i]->m_vertices[j]);
-			}
-
-			for (int j = 0; j < lines[i]->m_tris.m_size; j++)
+			if (!parallel)
 			{
-				destBuf->PushIndex(destBufStart + lines[i]->m_tris[j].m_indices[0]);
-				destBuf->PushIndex(destBufStart + lines[i]->m_tris[j].m_indices[1]);
-				destBuf->PushIndex(destBufStart + lines[i]->m_tris[j].m_indices[2]);
+				m_lineStroke.buf = destBuf;
+				StrokeLines(m_lineStroke, points, count, firstSegment, endSegment, false, opts, style, cap, jointType, addUpperLowerIndices);
 			}
 		}
 
-		Vec2 bbMin, bbMax;
-		New_GetConvexBB(destBuf, drawBufferStartBeforeLines, destBuf->vertexBuffer.m_size, bbMin, bbMax);
-		New_CalculateVertexUVsAndColor(destBuf, drawBufferStartBeforeLines, destBuf->vertexBuffer.m_size, bbMin, bbMax, opts.color);
-
-		if (Math::IsEqualMarg(style.outlineOptions.thickness, 0.0f) && !style.aaEnabled)
+		if (parallel)
+			WriteLineChunks(destBuf, opts.color);
+		else
 		{
-			for (int i = 0; i < lines.m_size; i++)
-				delete lines[i];
-
-			lines.clear();
-			return;
+			Vec2 bbMin, bbMax;
+			Utility::GetVerticesBoundingBox(destBuf->vertexBuffer.m_data + drawBufferStartBeforeLines, destBuf->vertexBuffer.m_size - drawBufferStartBeforeLines, bbMin, bbMax);
+			Utility::CalculateVertexUVsAndColors(destBuf->vertexBuffer.m_data + drawBufferStartBeforeLines, destBuf->vertexBuffer.m_size - drawBufferStartBeforeLines, bbMin, bbMax, opts.color, false);
 		}
 
-		int drawBufferStartForOutlines = drawBufferStartBeforeLines;
-
-		Array<int> totalUpperIndices;
-		Array<int> totalLowerIndices;
+		if (!addUpperLowerIndices)
+			return;
 
-		for (int i = 0; i < lines.m_size; i++)
+#ifdef LINAVG_VERTEX_EDGE_AA
+		if (Math::IsEqualMarg(style.outlineOptions.thickness, 0.0f))
 		{
-			for (int j = 0; j < lines[i]->m_upperIndices.m_size; j++)
-				totalUpperIndices.push_back(drawBufferStartForOutlines + lines[i]->m_upperIndices[j]);
+			// Line triangles span from lower to upper vertices, joint centers stay inside.
+			for (int i = 0; i < m_lineStroke.lowerIndices.m_size; i++)
+				destBuf->vertexBuffer[m_lineStroke.lowerIndices[i]].edge = 1.0f;
 
-			for (int j = 0; j < lines[i]->m_lowerIndices.m_size; j++)
-				totalLowerIndices.push_back(drawBufferStartForOutlines + lines[i]->m_lowerIndices[j]);
+			for (int i = 0; i < m_lineStroke.upperIndices.m_size; i++)
+				destBuf->vertexBuffer[m_lineStroke.upperIndices[i]].edge = -1.0f;
 
-			drawBufferStartForOutlines += lines[i]->m_vertices.m_size;
+			return;
 		}
+#endif
 
-		if (!Math::IsEqualMarg(style.outlineOptions.thickness, 0.0f))
-		{
-			Array<int> indicesOrder;
-			for (int i = 0; i < totalLowerIndices.m_size; i++)
-				indicesOrder.push_back(totalLowerIndices[i]);
+		m_lineOutlineIndices.shrink(0);
+		m_lineOutlineIndices.append(m_lineStroke.lowerIndices.m_data, m_lineStroke.lowerIndices.m_size);
 
-			for (int i = totalUpperIndices.m_size - 1; i > -1; i--)
-				indicesOrder.push_back(totalUpperIndices[i]);
+		for (int i = m_lineStroke.upperIndices.m_size - 1; i > -1; i--)
+			m_lineOutlineIndices.push_back(m_lineStroke.upperIndices[i]);
 
-			DrawOutlineAroundShape(destBuf, style, &indicesOrder[0], indicesOrder.m_size, style.outlineOptions.thickness, false, drawOrder, OutlineCallType::Normal);
-		}
-		else if (style.aaEnabled)
+		if (!Math::IsEqualMarg(style.outlineOptions.thickness, 0.0f))
+			DrawOutlineAroundShape(destBuf, style, m_lineOutlineIndices.m_data, m_lineOutlineIndices.m_size, style.outlineOptions.thickness, false, drawOrder, OutlineCallType::Normal);
+		else
 		{
 			StyleOptions opts2	 = StyleOptions(style);
 			opts2.outlineOptions = OutlineOptions::FromStyle(style, OutlineDrawDirection::Both);
-
-			Array<int> indicesOrder;
-			for (int i = 0; i < totalLowerIndices.m_size; i++)
-				indicesOrder.push_back(totalLowerIndices[i]);
-
-			for (int i = totalUpperIndices.m_size - 1; i > -1; i--)
-				indicesOrder.push_back(totalUpperIndices[i]);
-
-			for (int i = 0; i < indicesOrder.m_size; i++)
-			{
-				Vertex& v	= destBuf->vertexBuffer[indicesOrder[i]];
-				Vec4	col = v.col;
-			}
-			DrawOutlineAroundShape(destBuf, opts2, &indicesOrder[0], indicesOrder.m_size, opts2.outlineOptions.thickness, false, drawOrder, OutlineCallType::AA);
+			DrawOutlineAroundShape(destBuf, opts2, m_lineOutlineIndices.m_data, m_lineOutlineIndices.m_size, opts2.outlineOptions.thickness, false, drawOrder, OutlineCallType::AA);
 		}
+	}
 
-		for (int i = 0; i < lines.m_size; i++)
-			delete lines[i];
-
-		lines.clear();
+	void Drawer::DrawLinesSplit(Vec2* points, int count, int firstSegment, int endSegment, StyleOptions& opts, LineCapDirection cap, LineJointType jointType, int drawOrder)
+	{
+		// The first half strokes into the middle segment to join it & the second half warms up on the ones before, so the joint at the seam is kept.
+		// Thickness & caps follow the whole polyline's segment indices, both halves match stroking it at once.
+		const int mid = firstSegment + (endSegment - firstSegment) / 2;
+		DrawLinesRange(points, count, firstSegment, mid, opts, cap, jointType, drawOrder);
+		DrawLinesRange(points, count, mid, endSegment, opts, cap, jointType, drawOrder);
 	}
 
 	void Drawer::DrawImage(TextureHandle textureHandle, const Vec2& pos, const Vec2& size, Vec4 tint, float rotateAngle, int drawOrder, Vec4 uvTilingAndOffset, Vec2 uvTL, Vec2 uvBR)
 	{
+		if (m_deferred)
+		{
+			DeferredCommand& cmd = RecordDeferred(DeferredCommandType::Image, rotateAngle, drawOrder);
+			cmd.textureHandle	 = textureHandle;
+			cmd.points[0]		 = pos;
+			cmd.points[1]		 = size;
+			cmd.points[2]		 = uvTL;
+			cmd.points[3]		 = uvBR;
+			cmd.vectors[0]		 = tint;
+			cmd.vectors[1]		 = uvTilingAndOffset;
+			return;
+		}
+
 		StyleOptions style;
 		style.aaEnabled				 = false;
 		style.color					 = tint;
@@ -364,17 +1148,28 @@ namespace LinaVG
 		const Vec2 min				 = Vec2(pos.x - size.x / 2.0f, pos.y - size.y / 2.0f);
 		const Vec2 max				 = Vec2(pos.x + size.x / 2.0f, pos.y + size.y / 2.0f);
 
-		m_bufferStore.GetData().m_uvOverride.m_override = true;
-		m_bufferStore.GetData().m_uvOverride.m_uvTL		= uvTL;
-		m_bufferStore.GetData().m_uvOverride.m_uvBR		= uvBR;
+		GetRecordData().m_uvOverride.m_override = true;
+		GetRecordData().m_uvOverride.m_uvTL		= uvTL;
+		GetRecordData().m_uvOverride.m_uvBR		= uvBR;
 		DrawRect(min, max, style, rotateAngle, drawOrder);
-		m_bufferStore.GetData().m_uvOverride.m_override = false;
-		m_bufferStore.GetData().m_uvOverride.m_uvTL		= Vec2(0, 0);
-		m_bufferStore.GetData().m_uvOverride.m_uvBR		= Vec2(1, 1);
+		GetRecordData().m_uvOverride.m_override = false;
+		GetRecordData().m_uvOverride.m_uvTL		= Vec2(0, 0);
+		GetRecordData().m_uvOverride.m_uvBR		= Vec2(1, 1);
 	}
 
 	void Drawer::DrawTriangle(const Vec2& top, const Vec2& right, const Vec2& left, StyleOptions& style, float rotateAngle, int drawOrder)
 	{
+		if (m_deferred || IsShapeCacheable(style.uniqueID))
+		{
+			DeferredCommand& cmd = RecordDeferred(DeferredCommandType::Triangle, rotateAngle, drawOrder);
+			cmd.optionsIndex	 = RecordDeferredStyle(style);
+			cmd.points[0]		 = top;
+			cmd.points[1]		 = right;
+			cmd.points[2]		 = left;
+			FinishRecord();
+			return;
+		}
+
 		// NR - SC - def buf
 		// NR - SC - text
 		// NR - VH - DEF
@@ -390,13 +1185,26 @@ namespace LinaVG
 		}*/
 
 		if (Math::IsEqualMarg(style.rounding, 0.0f))
-			FillTri_NoRound(&m_bufferStore.GetData().GetDefaultBuffer(style.userData, style.uniqueID, drawOrder, DrawBufferShapeType::Shape, style.textureHandle, style.textureTilingAndOffset), rotateAngle, top, right, left, style, drawOrder);
+			FillTri_NoRound(&GetRecordData().GetDefaultBuffer(style.userData, style.uniqueID, drawOrder, DrawBufferShapeType::Shape, style.textureHandle, style.textureTilingAndOffset, GetFillVertexCount(3, style.isFilled)), rotateAngle, top, right, left, style, drawOrder);
 		else
-			FillTri_Round(&m_bufferStore.GetData().GetDefaultBuffer(style.userData, style.uniqueID, drawOrder, DrawBufferShapeType::Shape, style.textureHandle, style.textureTilingAndOffset), style.onlyRoundTheseCorners, rotateAngle, top, right, left, style.rounding, style, drawOrder);
+			FillTri_Round(&GetRecordData().GetDefaultBuffer(style.userData, style.uniqueID, drawOrder, DrawBufferShapeType::Shape, style.textureHandle, style.textureTilingAndOffset, GetRoundedTriVertexCount(top, right, left, style)), style.onlyRoundTheseCorners, rotateAngle, top, right, left, style.rounding, style, drawOrder);
 	}
 
 	void Drawer::DrawRect(const Vec2& min, const Vec2& max, StyleOptions& style, float rotateAngle, int drawOrder)
 	{
+		if (m_deferred || IsShapeCacheable(style.uniqueID))
+		{
+			DeferredCommand& cmd = RecordDeferred(DeferredCommandType::Rect, rotateAngle, drawOrder);
+			cmd.optionsIndex	 = RecordDeferredStyle(style);
+			cmd.points[0]		 = min;
+			cmd.points[1]		 = max;
+			FinishRecord();
+			return;
+		}
+
+		if (Config.instancedShapesEnabled && DrawRectInstance(min, max, style, rotateAngle, drawOrder))
+			return;
+
 		/*const Vec4ui& clip = m_bufferStore.GetData().m_clipRect;
 		if (clip.z != 0 || clip.w != 0)
 		{
@@ -405,13 +1213,24 @@ namespace LinaVG
 		}*/
 
 		if (Math::IsEqualMarg(style.rounding, 0.0f))
-			FillRect_NoRound(&m_bufferStore.GetData().GetDefaultBuffer(style.userData, style.uniqueID, drawOrder, DrawBufferShapeType::Shape, style.textureHandle, style.textureTilingAndOffset), rotateAngle, min, max, style, drawOrder);
+			FillRect_NoRound(&GetRecordData().GetDefaultBuffer(style.userData, style.uniqueID, drawOrder, DrawBufferShapeType::Shape, style.textureHandle, style.textureTilingAndOffset, GetFillVertexCount(4, style.isFilled)), rotateAngle, min, max, style, drawOrder);
 		else
-			FillRect_Round(&m_bufferStore.GetData().GetDefaultBuffer(style.userData, style.uniqueID, drawOrder, DrawBufferShapeType::Shape, style.textureHandle, style.textureTilingAndOffset), style.onlyRoundTheseCorners, rotateAngle, min, max, style.rounding, style, drawOrder);
+			FillRect_Round(&GetRecordData().GetDefaultBuffer(style.userData, style.uniqueID, drawOrder, DrawBufferShapeType::Shape, style.textureHandle, style.textureTilingAndOffset, GetRoundedRectVertexCount(min, max, style)), style.onlyRoundTheseCorners, rotateAngle, min, max, style.rounding, style, drawOrder);
 	}
 
 	void Drawer::DrawNGon(const Vec2& center, float radius, int n, StyleOptions& style, float rotateAngle, int drawOrder)
 	{
+		if (m_deferred || IsShapeCacheable(style.uniqueID))
+		{
+			DeferredCommand& cmd = RecordDeferred(DeferredCommandType::NGon, rotateAngle, drawOrder);
+			cmd.optionsIndex	 = RecordDeferredStyle(style);
+			cmd.points[0]		 = center;
+			cmd.floats[0]		 = radius;
+			cmd.ints[0]			 = n;
+			FinishRecord();
+			return;
+		}
+
 		/*const Vec4ui& clip = m_bufferStore.GetData().m_clipRect;
 		if (clip.z != 0 || clip.w != 0)
 		{
@@ -421,7 +1240,7 @@ namespace LinaVG
 				return;
 		}*/
 
-		FillNGon(&m_bufferStore.GetData().GetDefaultBuffer(style.userData, style.uniqueID, drawOrder, DrawBufferShapeType::Shape, style.textureHandle, style.textureTilingAndOffset), rotateAngle, center, radius, n, style, drawOrder);
+		FillNGon(&GetRecordData().GetDefaultBuffer(style.userData, style.uniqueID, drawOrder, DrawBufferShapeType::Shape, style.textureHandle, style.textureTilingAndOffset, (n + 1) * 2), rotateAngle, center, radius, n, style, drawOrder);
 	}
 
 	void Drawer::DrawConvex(Vec2* points, int size, StyleOptions& style, float rotateAngle, int drawOrder)
@@ -433,6 +1252,15 @@ namespace LinaVG
 			return;
 		}
 
+		if (m_deferred || IsShapeCacheable(style.uniqueID))
+		{
+			DeferredCommand& cmd = RecordDeferred(DeferredCommandType::Convex, rotateAngle, drawOrder);
+			cmd.optionsIndex	 = RecordDeferredStyle(style);
+			RecordDeferredPoints(cmd, points, size);
+			FinishRecord();
+			return;
+		}
+
 		/*const Vec4ui& clip = m_bufferStore.GetData().m_clipRect;
 		if (clip.z != 0 || clip.w != 0)
 		{
@@ -443,11 +1271,28 @@ namespace LinaVG
 		}*/
 
 		const Vec2 avgCenter = Math::GetPolygonCentroidFast(points, size);
-		FillConvex(&m_bufferStore.GetData().GetDefaultBuffer(style.userData, style.uniqueID, drawOrder, DrawBufferShapeType::Shape, style.textureHandle, style.textureTilingAndOffset), rotateAngle, points, size, avgCenter, style, drawOrder);
+		FillConvex(&GetRecordData().GetDefaultBuffer(style.userData, style.uniqueID, drawOrder, DrawBufferShapeType::Shape, style.textureHandle, style.textureTilingAndOffset, (size + 1) * 2), rotateAngle, points, size, avgCenter, style, drawOrder);
 	}
 
 	void Drawer::DrawCircle(const Vec2& center, float radius, StyleOptions& style, int segments, float rotateAngle, float startAngle, float endAngle, int drawOrder)
 	{
+		if (m_deferred || IsShapeCacheable(style.uniqueID))
+		{
+			DeferredCommand& cmd = RecordDeferred(DeferredCommandType::Circle, rotateAngle, drawOrder);
+			cmd.optionsIndex	 = RecordDeferredStyle(style);
+			cmd.points[0]		 = center;
+			cmd.floats[0]		 = radius;
+			cmd.floats[1]		 = startAngle;
+			cmd.floats[2]		 = endAngle;
+			cmd.ints[0]			 = segments;
+			FinishRecord();
+			return;
+		}
+
+		// Rotation only moves the vertices of a circle around.
+		if (Config.instancedShapesEnabled && DrawCircleInstance(center, radius, style, startAngle, endAngle, drawOrder))
+			return;
+
 		if (startAngle == endAngle)
 			endAngle = startAngle + 360.0f;
 
@@ -460,7 +1305,9 @@ namespace LinaVG
 				return;
 		}*/
 
-		FillCircle(&m_bufferStore.GetData().GetDefaultBuffer(style.userData, style.uniqueID, drawOrder, DrawBufferShapeType::Shape, style.textureHandle, style.textureTilingAndOffset), rotateAngle, center, radius, segments, startAngle, endAngle, style, drawOrder);
+		// Arcs push one point past their last segment, plus a step of float drift.
+		const int vertexCount = GetFillVertexCount(GetCircleSegments(radius, segments) + 2, style.isFilled);
+		FillCircle(&GetRecordData().GetDefaultBuffer(style.userData, style.uniqueID, drawOrder, DrawBufferShapeType::Shape, style.textureHandle, style.textureTilingAndOffset, vertexCount), rotateAngle, center, radius, segments, startAngle, endAngle, style, drawOrder);
 	}
 
 #ifndef LINAVG_DISABLE_TEXT_SUPPORT
@@ -470,9 +1317,57 @@ namespace LinaVG
 		if (text == NULL || text[0] == '\0')
 			return;
 
-		Font* font = opts.font;
+		// Out data is expected to be filled on return, so such calls can't be cached. Deferred ones lay the text out right away to fill it.
+		if (m_deferred || (IsShapeCacheable(opts.uniqueID) && outData == nullptr))
+		{
+			if (outData != nullptr)
+			{
+				m_textScratch.vertexBuffer.shrink(0);
+				m_textScratch.indexBuffer.shrink(0);
+				ProcessText(&m_textScratch, opts.font, text, position, Vec2(0.0f, 0.0f), opts.color, opts, rotateAngle, outData, false);
+			}
+
+			DeferredCommand& cmd = RecordDeferred(DeferredCommandType::Text, rotateAngle, drawOrder);
+			cmd.optionsIndex	 = static_cast<int>(m_deferredTextOptions.size());
+			cmd.points[0]		 = position;
+			cmd.flag			 = skipCache;
+			cmd.dataOffset		 = m_deferredText.m_size;
+			cmd.dataCount		 = Utility::GetTextCharacterSize(text);
+			m_deferredTextOptions.push_back(opts);
+
+			m_deferredText.append(text, cmd.dataCount + 1);
+
+			FinishRecord();
+			return;
+		}
+
+		Font*					  font			 = opts.font;
+		const DrawBufferShapeType shapeType		 = font->isSDF ? DrawBufferShapeType::SDFText : DrawBufferShapeType::Text;
+		const int				  characterCount = Utility::GetTextCharacterSize(text);
+
+		// Glyph quads are independent, text too large for a single buffer is laid out once & split across rolled over buffers, uncached.
+		if (characterCount * 4 > LINAVG_MAX_BUFFER_VERTICES)
+		{
+			m_textScratch.vertexBuffer.shrink(0);
+			m_textScratch.indexBuffer.shrink(0);
+			ProcessText(&m_textScratch, font, text, position, Vec2(0.0f, 0.0f), opts.color, opts, rotateAngle, outData, false);
+
+			const int quadCount = m_textScratch.vertexBuffer.m_size / 4;
+			for (int quad = 0; quad < quadCount;)
+			{
+				const int	count = Math::Min(quadCount - quad, LINAVG_MAX_BUFFER_VERTICES / 4);
+				DrawBuffer& dst	  = GetRecordData().GetDefaultBuffer(opts.userData, opts.uniqueID, drawOrder, shapeType, font->atlas, Vec4(1, 1, 0, 0), count * 4);
+
+				// Indices of the layout wrapped around the index range, rebasing wraps them back relative to dst.
+				dst.PushIndices(m_textScratch.indexBuffer.m_data + quad * 6, count * 6, dst.vertexBuffer.m_size - quad * 4);
+				dst.PushVertices(m_textScratch.vertexBuffer.m_data + quad * 4, count * 4);
+				quad += count;
+			}
+
+			return;
+		}
 
-		DrawBuffer* buf		   = &m_bufferStore.GetData().GetDefaultBuffer(opts.userData, opts.uniqueID, drawOrder, font->isSDF ? DrawBufferShapeType::SDFText : DrawBufferShapeType::Text, font->atlas, Vec4(1, 1, 0, 0));
+		DrawBuffer* buf		   = &GetRecordData().GetDefaultBuffer(opts.userData, opts.uniqueID, drawOrder, shapeType, font->atlas, Vec4(1, 1, 0, 0), characterCount * 4);
 		const int	vtxStart   = buf->vertexBuffer.m_size;
 		const int	indexStart = buf->indexBuffer.m_size;
 
@@ -482,22 +1377,29 @@ namespace LinaVG
 			ProcessText(buf, font, text, position, Vec2(0.0f, 0.0f), opts.color, opts, rotateAngle, outData, clipTexts);
 		else
 		{
-			const int vtxSize = buf->vertexBuffer.m_size;
-			const int idxSize = buf->indexBuffer.m_size;
+			// Cached unrotated at the origin, at unit scale if the layout scales linearly. Replays transform it into place.
+			TextOptions canonical = opts;
+			float		scale	  = 1.0f;
 
-			uint32_t sid = Utility::FnvHash(text);
-			if (m_bufferStore.GetData().CheckTextCache(sid, opts, buf) == nullptr)
+			if (IsTextLayoutScalable(opts))
 			{
-				ProcessText(buf, font, text, Vec2(0, 0), Vec2(0.0f, 0.0f), opts.color, opts, rotateAngle, outData, false);
-				m_bufferStore.GetData().AddTextCache(sid, opts, buf, vtxStart, indexStart);
+				scale				= opts.textScale;
+				canonical.textScale = 1.0f;
 			}
 
-			// Update position
-			for (int i = vtxStart; i < buf->vertexBuffer.m_size; i++)
+			const Vec2	   offset = Vec2(static_cast<float>(Math::CustomRound(position.x)), static_cast<float>(Math::CustomRound(position.y)));
+			const uint64_t key	  = HashTextOptions(Utility::HashString(text), canonical);
+
+			if (GetRecordData().CheckTextCache(key, text, canonical, buf, offset, scale, rotateAngle) == nullptr)
 			{
-				auto& vtx = buf->vertexBuffer[i];
-				vtx.pos.x += static_cast<float>(Math::CustomRound(position.x));
-				vtx.pos.y += static_cast<float>(Math::CustomRound(position.y));
+				ProcessText(buf, font, text, Vec2(0, 0), Vec2(0.0f, 0.0f), canonical.color, canonical, 0.0f, outData, false);
+
+				const int  count  = buf->vertexBuffer.m_size - vtxStart;
+				const Vec2 center = count == 0 ? Vec2(0.0f, 0.0f) : GetVerticesCenter(buf, vtxStart, buf->vertexBuffer.m_size - 1);
+				GetRecordData().AddTextCache(key, text, canonical, center, buf, vtxStart, indexStart);
+
+				Vertex* vertices = buf->vertexBuffer.m_data + vtxStart;
+				Utility::TransformText(vertices, vertices, count, center, offset, scale, rotateAngle);
 			}
 		}
 	}
@@ -512,6 +1414,39 @@ namespace LinaVG
 
 #endif
 
+	bool Drawer::DrawRectInstance(const Vec2& min, const Vec2& max, const StyleOptions& style, float rotateAngle, int drawOrder)
+	{
+		ShapeInstance instance;
+		if (GetRecordData().m_rectOverrideData.overrideRectPositions || !FillInstanceStyle(instance, style))
+			return false;
+
+		instance.center	  = Vec2((min.x + max.x) / 2.0f, (min.y + max.y) / 2.0f);
+		instance.halfSize = Vec2(Math::Abs(max.x - min.x) / 2.0f, Math::Abs(max.y - min.y) / 2.0f);
+		instance.rotation = rotateAngle * LVG_DEG2RAD;
+
+		// Same radius FillRect_Round arcs around.
+		const float radius	 = Math::Clamp(style.rounding, 0.0f, 0.9f) * Math::Min(instance.halfSize.x, instance.halfSize.y);
+		const auto	corner	 = [&](int i) { return style.onlyRoundTheseCorners.m_size == 0 || style.onlyRoundTheseCorners.findIndex(i) != -1 ? radius : 0.0f; };
+		instance.cornerRadii = Vec4(corner(0), corner(1), corner(2), corner(3));
+
+		GetRecordData().GetDefaultBuffer(style.userData, style.uniqueID, drawOrder, DrawBufferShapeType::Instanced, NULL_TEXTURE, Vec4(1.0f, 1.0f, 0.0f, 0.0f)).instanceBuffer.push_back(instance);
+		return true;
+	}
+
+	bool Drawer::DrawCircleInstance(const Vec2& center, float radius, const StyleOptions& style, float startAngle, float endAngle, int drawOrder)
+	{
+		ShapeInstance instance;
+		if ((startAngle != endAngle && Math::Abs(endAngle - startAngle) != 360.0f) || !FillInstanceStyle(instance, style))
+			return false;
+
+		instance.center		 = center;
+		instance.halfSize	 = Vec2(radius, radius);
+		instance.cornerRadii = Vec4(radius, radius, radius, radius);
+
+		GetRecordData().GetDefaultBuffer(style.userData, style.uniqueID, drawOrder, DrawBufferShapeType::Instanced, NULL_TEXTURE, Vec4(1.0f, 1.0f, 0.0f, 0.0f)).instanceBuffer.push_back(instance);
+		return true;
+	}
+
 	void Drawer::FillRect_NoRound(DrawBuffer* buf, float rotateAngle, const Vec2& min, const Vec2& max, StyleOptions& opts, int drawOrder)
 	{
 		Vertex v[4];
@@ -519,12 +1454,31 @@ namespace LinaVG
 
 		const int current = buf->vertexBuffer.m_size;
 
-		for (int i = 0; i < 4; i++)
-			buf->PushVertex(v[i]);
+		buf->PushVertices(v, 4);
 
 		const Vec2 center = Vec2((min.x + max.x) / 2.0f, (min.y + max.y) / 2.0f);
 
-		if (opts.isFilled)
+#ifdef LINAVG_VERTEX_EDGE_AA
+		// Edge distance needs an inner vertex to fall off to, fan around the center instead.
+		const bool edgeAA = opts.isFilled && opts.aaEnabled && Math::IsEqualMarg(opts.outlineOptions.thickness, 0.0f);
+#else
+		const bool edgeAA = false;
+#endif
+
+		if (edgeAA)
+		{
+			Vertex c;
+			c.pos = center;
+			buf->PushVertex(c);
+
+			for (int i = 0; i < 4; i++)
+			{
+				buf->PushIndex(current + 4);
+				buf->PushIndex(current + i);
+				buf->PushIndex(current + (i + 1) % 4);
+			}
+		}
+		else if (opts.isFilled)
 		{
 			buf->PushIndex(current);
 			buf->PushIndex(current + 1);
@@ -537,12 +1491,16 @@ namespace LinaVG
 			ConvexExtrudeVertices(buf, opts, center, current, current + 3, opts.thickness.start);
 
 		const int currentNow = buf->vertexBuffer.m_size;
-		New_CalculateVertexUVsAndColor(buf, current, currentNow, v[0].pos, v[2].pos, opts.color);
+		Utility::CalculateVertexUVsAndColors(buf->vertexBuffer.m_data + current, currentNow - current, v[0].pos, v[2].pos, opts.color, false);
 
 		RotateVertices(buf->vertexBuffer, center, current, opts.isFilled ? current + 3 : current + 7, rotateAngle);
 
 		if (!Math::IsEqualMarg(opts.outlineOptions.thickness, 0.0f))
 			DrawOutline(buf, opts, opts.isFilled ? 4 : 8, false, drawOrder);
+#ifdef LINAVG_VERTEX_EDGE_AA
+		else if (edgeAA)
+			SetVertexEdges(buf, current, current + 3, 1.0f);
+#endif
 		else if (opts.aaEnabled)
 		{
 			StyleOptions opts2	 = StyleOptions(opts);
@@ -574,7 +1532,7 @@ namespace LinaVG
 		// For each corner vertices, first we inflate them towards the center by the magnitude.
 		float		startAngle	  = 180.0f;
 		float		endAngle	  = 270.0f;
-		const float angleIncrease = GetAngleIncrease(rounding);
+		const float angleIncrease = GetAngleIncrease(rounding, roundingMag);
 		const int	startIndex	  = buf->vertexBuffer.m_size;
 		int			vertexCount	  = 0;
 
@@ -608,11 +1566,11 @@ namespace LinaVG
 			Vec2	   inf1		 = Vec2(inf0.x + usedRight.x * roundingMag, inf0.y + usedRight.y * roundingMag);
 
 			// After a vector is inflated, we use it as a center to draw an arc, arc range is based on which corner we are currently drawing.
+			ArcStepper arc(inf1, roundingMag, startAngle, angleIncrease);
 			for (float k = startAngle; k < endAngle + 2.5f; k += angleIncrease)
 			{
-				const Vec2 p = Math::GetPointOnCircle(inf1, roundingMag, k);
-				Vertex	   cornerVertex;
-				cornerVertex.pos = p;
+				Vertex cornerVertex;
+				cornerVertex.pos = arc.Next();
 				buf->PushVertex(cornerVertex);
 				vertexCount++;
 			}
@@ -621,7 +1579,7 @@ namespace LinaVG
 		}
 
 		const int currentIndex = buf->vertexBuffer.m_size;
-		New_CalculateVertexUVsAndColor(buf, startIndex, currentIndex, v[0].pos, v[2].pos, opts.color);
+		Utility::CalculateVertexUVsAndColors(buf->vertexBuffer.m_data + startIndex, currentIndex - startIndex, v[0].pos, v[2].pos, opts.color, false);
 
 		if (opts.isFilled)
 		{
@@ -654,7 +1612,7 @@ namespace LinaVG
 			// v[0].uv	 = Vec2((m_bufferStore.GetData().m_uvOverride.m_uvTL.x + m_bufferStore.GetData().m_uvOverride.m_uvBR.x) / 2.0f, (m_bufferStore.GetData().m_uvOverride.m_uvTL.y + m_bufferStore.GetData().m_uvOverride.m_uvBR.y) / 2.0f);
 		}
 
-		if (!m_bufferStore.GetData().m_rectOverrideData.overrideRectPositions)
+		if (!GetRecordData().m_rectOverrideData.overrideRectPositions)
 		{
 			v[i].pos	   = min;
 			v[i + 1].pos.x = max.x;
@@ -666,10 +1624,10 @@ namespace LinaVG
 		}
 		else
 		{
-			v[i].pos	 = m_bufferStore.GetData().m_rectOverrideData.m_p1;
-			v[i + 1].pos = m_bufferStore.GetData().m_rectOverrideData.m_p2;
-			v[i + 2].pos = m_bufferStore.GetData().m_rectOverrideData.m_p3;
-			v[i + 3].pos = m_bufferStore.GetData().m_rectOverrideData.m_p4;
+			v[i].pos	 = GetRecordData().m_rectOverrideData.m_p1;
+			v[i + 1].pos = GetRecordData().m_rectOverrideData.m_p2;
+			v[i + 2].pos = GetRecordData().m_rectOverrideData.m_p3;
+			v[i + 3].pos = GetRecordData().m_rectOverrideData.m_p4;
 		}
 
 		// v[i].uv		= m_bufferStore.GetData().m_uvOverride.m_uvTL;
@@ -685,12 +1643,31 @@ namespace LinaVG
 
 		const int startIndex = buf->vertexBuffer.m_size;
 
-		for (int i = 0; i < 3; i++)
-			buf->PushVertex(v[i]);
+		buf->PushVertices(v, 3);
 
 		const Vec2 center = Vec2((p1.x + p2.x + p3.x) / 3.0f, (p1.y + p2.y + p3.y) / 3.0f);
 
-		if (opts.isFilled)
+#ifdef LINAVG_VERTEX_EDGE_AA
+		// Edge distance needs an inner vertex to fall off to, fan around the center instead.
+		const bool edgeAA = opts.isFilled && opts.aaEnabled && Math::IsEqualMarg(opts.outlineOptions.thickness, 0.0f);
+#else
+		const bool edgeAA = false;
+#endif
+
+		if (edgeAA)
+		{
+			Vertex c;
+			c.pos = center;
+			buf->PushVertex(c);
+
+			for (int i = 0; i < 3; i++)
+			{
+				buf->PushIndex(startIndex + 3);
+				buf->PushIndex(startIndex + i);
+				buf->PushIndex(startIndex + (i + 1) % 3);
+			}
+		}
+		else if (opts.isFilled)
 		{
 			buf->PushIndex(startIndex);
 			buf->PushIndex(startIndex + 1);
@@ -703,12 +1680,16 @@ namespace LinaVG
 
 		Vec2 bbMin, bbMax;
 		GetTriangleBoundingBox(p1, p2, p3, bbMin, bbMax);
-		New_CalculateVertexUVsAndColor(buf, startIndex, currentIndex, bbMin, bbMax, opts.color);
+		Utility::CalculateVertexUVsAndColors(buf->vertexBuffer.m_data + startIndex, currentIndex - startIndex, bbMin, bbMax, opts.color, false);
 
 		RotateVertices(buf->vertexBuffer, center, startIndex, opts.isFilled ? startIndex + 2 : startIndex + 5, rotateAngle);
 
 		if (!Math::IsEqualMarg(opts.outlineOptions.thickness, 0.0f))
 			DrawOutline(buf, opts, opts.isFilled ? 3 : 6, false, drawOrder);
+#ifdef LINAVG_VERTEX_EDGE_AA
+		else if (edgeAA)
+			SetVertexEdges(buf, startIndex, startIndex + 2, 1.0f);
+#endif
 		else if (opts.aaEnabled)
 		{
 			StyleOptions opts2	 = StyleOptions(opts);
@@ -776,7 +1757,7 @@ namespace LinaVG
 				const Vec2	inter2	   = Vec2(v[i].pos.x + toCenter02.x * roundingMag, v[i].pos.y + toCenter02.y * roundingMag);
 				Array<Vec2> arc;
 
-				GetArcPoints(arc, inter1, inter2, v[i].pos, 0.0f, 36, false, angleOffset);
+				GetArcPoints(arc, inter1, inter2, v[i].pos, 0.0f, GetCornerArcSegments(inter1, inter2), false, angleOffset);
 
 				for (int j = 0; j < arc.m_size; j++)
 				{
@@ -794,7 +1775,7 @@ namespace LinaVG
 				const Vec2	inter1	   = Vec2(v[i].pos.x + toCenter01.x * roundingMag, v[i].pos.y + toCenter01.y * roundingMag);
 				const Vec2	inter2	   = Vec2(v[i].pos.x + toCenter12.x * roundingMag, v[i].pos.y + toCenter12.y * roundingMag);
 				Array<Vec2> arc;
-				GetArcPoints(arc, inter1, inter2, v[i].pos, 0.0f, 36, false, angleOffset);
+				GetArcPoints(arc, inter1, inter2, v[i].pos, 0.0f, GetCornerArcSegments(inter1, inter2), false, angleOffset);
 				for (int j = 0; j < arc.m_size; j++)
 				{
 					Vertex cornerVertex;
@@ -811,7 +1792,7 @@ namespace LinaVG
 				const Vec2	inter1	   = Vec2(v[i].pos.x + toCenter12.x * roundingMag, v[i].pos.y + toCenter12.y * roundingMag);
 				const Vec2	inter2	   = Vec2(v[i].pos.x + toCenter02.x * roundingMag, v[i].pos.y + toCenter02.y * roundingMag);
 				Array<Vec2> arc;
-				GetArcPoints(arc, inter1, inter2, v[i].pos, 0.0f, 36, false, angleOffset);
+				GetArcPoints(arc, inter1, inter2, v[i].pos, 0.0f, GetCornerArcSegments(inter1, inter2), false, angleOffset);
 				for (int j = 0; j < arc.m_size; j++)
 				{
 					Vertex cornerVertex;
@@ -829,7 +1810,7 @@ namespace LinaVG
 
 		Vec2 bbMin, bbMax;
 		GetTriangleBoundingBox(p1, p2, p3, bbMin, bbMax);
-		New_CalculateVertexUVsAndColor(buf, startIndex, buf->vertexBuffer.m_size, bbMin, bbMax, opts.color);
+		Utility::CalculateVertexUVsAndColors(buf->vertexBuffer.m_data + startIndex, buf->vertexBuffer.m_size - startIndex, bbMin, bbMax, opts.color, false);
 
 		RotateVertices(buf->vertexBuffer, center, opts.isFilled ? startIndex + 1 : startIndex, opts.isFilled ? startIndex + vertexCount : startIndex + (vertexCount * 2) - 1, rotateAngle);
 
@@ -864,10 +1845,7 @@ namespace LinaVG
 
 		const int startIndex = buf->vertexBuffer.m_size;
 
-		for (int i = 0; i < v.m_size; i++)
-		{
-			buf->PushVertex(v[i]);
-		}
+		buf->PushVertices(v.m_data, v.m_size);
 
 		if (opts.isFilled)
 			ConvexFillVertices(startIndex, startIndex + n, buf->indexBuffer);
@@ -876,7 +1854,7 @@ namespace LinaVG
 
 		const Vec2 bbMin = Vec2(center.x - radius, center.y - radius);
 		const Vec2 bbMax = Vec2(center.x + radius, center.y + radius);
-		New_CalculateVertexUVsAndColor(buf, startIndex, buf->vertexBuffer.m_size, bbMin, bbMax, opts.color);
+		Utility::CalculateVertexUVsAndColors(buf->vertexBuffer.m_data + startIndex, buf->vertexBuffer.m_size - startIndex, bbMin, bbMax, opts.color, false);
 
 		RotateVertices(buf->vertexBuffer, center, opts.isFilled ? startIndex + 1 : startIndex, opts.isFilled ? startIndex + n : startIndex + (n * 2) - 1, rotateAngle);
 
@@ -900,11 +1878,12 @@ namespace LinaVG
 			vertArray.push_back(v);
 		}
 
-		int count = 0;
+		int		   count = 0;
+		ArcStepper arc(center, radius, 0.0f, angleIncrease);
 		for (float i = 0.0f; i < 360.0f; i += angleIncrease)
 		{
 			Vertex v;
-			v.pos = Math::GetPointOnCircle(center, radius, i);
+			v.pos = arc.Next();
 			vertArray.push_back(v);
 			count++;
 			if (count == n)
@@ -919,8 +1898,7 @@ namespace LinaVG
 
 		const int startIndex = buf->vertexBuffer.m_size;
 
-		for (int i = 0; i < v.m_size; i++)
-			buf->PushVertex(v[i]);
+		buf->PushVertices(v.m_data, v.m_size);
 
 		const bool isFullCircle = Math::Abs(endAngle - startAngle) == 360.0f;
 		const int  totalSize	= v.m_size - 1;
@@ -934,7 +1912,7 @@ namespace LinaVG
 
 		const Vec2 bbMin = Vec2(center.x - radius, center.y - radius);
 		const Vec2 bbMax = Vec2(center.x + radius, center.y + radius);
-		New_CalculateVertexUVsAndColor(buf, startIndex, buf->vertexBuffer.m_size, bbMin, bbMax, opts.color);
+		Utility::CalculateVertexUVsAndColors(buf->vertexBuffer.m_data + startIndex, buf->vertexBuffer.m_size - startIndex, bbMin, bbMax, opts.color, false);
 
 		if (!Math::IsEqualMarg(opts.outlineOptions.thickness, 0.0f))
 		{
@@ -982,12 +1960,17 @@ namespace LinaVG
 				}
 				else
 				{
+#ifdef LINAVG_VERTEX_EDGE_AA
+					// The center is shared by all fan triangles, so only the arc gets an edge.
+					SetVertexEdges(buf, startIndex + 1, startIndex + totalSize, 1.0f);
+#else
 					Array<int> indices;
 
 					for (int i = 0; i < v.m_size; i++)
 						indices.push_back(startIndex + i);
 
 					DrawOutlineAroundShape(buf, opts2, &indices[0], v.m_size, opts2.outlineOptions.thickness, true, drawOrder, OutlineCallType::AA);
+#endif
 				}
 			}
 			else if (opts.outlineOptions.drawDirection == OutlineDrawDirection::Both)
@@ -1022,7 +2005,7 @@ namespace LinaVG
 			startAngle = 360.0f;
 		}
 
-		segments				  = Math::Clamp(segments, 6, 180);
+		segments				  = GetCircleSegments(radius, segments);
 		const float angleIncrease = 360.0f / (float)segments;
 
 		if (hasCenter)
@@ -1035,10 +2018,11 @@ namespace LinaVG
 		const float end		  = Math::Abs(startAngle - endAngle) == 360.0f ? endAngle : endAngle + angleIncrease;
 		Vec2		nextPoint = Vec2(-1.0f, -1.0f);
 		Vec2		lastPoint = Vec2(-1.0f, -1.0f);
+		ArcStepper	arc(center, radius, startAngle, angleIncrease);
 		for (float i = startAngle; i < end; i += angleIncrease)
 		{
 			Vertex v;
-			v.pos = Math::GetPointOnCircle(center, radius, i);
+			v.pos = arc.Next();
 			vertices.push_back(v);
 		}
 	}
@@ -1068,7 +2052,7 @@ namespace LinaVG
 
 		Vec2 bbMin, bbMax;
 		GetConvexBoundingBox(points, size, bbMin, bbMax);
-		New_CalculateVertexUVsAndColor(buf, startIndex, buf->vertexBuffer.m_size, bbMin, bbMax, opts.color);
+		Utility::CalculateVertexUVsAndColors(buf->vertexBuffer.m_data + startIndex, buf->vertexBuffer.m_size - startIndex, bbMin, bbMax, opts.color, false);
 
 		RotateVertices(buf->vertexBuffer, center, opts.isFilled ? startIndex + 1 : startIndex, opts.isFilled ? startIndex + size : startIndex + (size * 2) - 1, rotateAngle);
 
@@ -1160,17 +2144,18 @@ namespace LinaVG
 		if (Math::IsEqualMarg(angle, 0.0f))
 			return;
 
-		for (int i = startIndex; i < endIndex + 1; i++)
-		{
-			vertices[i].pos = Math::RotateAround(vertices[i].pos, center, angle);
-		}
+		Utility::RotateVertices(vertices.m_data + startIndex, endIndex - startIndex + 1, center, angle);
 	}
 
 	void Drawer::RotatePoints(Vec2* points, int size, const Vec2& center, float angle)
 	{
+		const float angleRads = LVG_DEG2RAD * angle;
+		const float cosAngle  = std::cos(angleRads);
+		const float sinAngle  = std::sin(angleRads);
+
 		for (int i = 0; i < size; i++)
 		{
-			points[i] = Math::RotateAround(points[i], center, angle);
+			points[i] = Math::RotateAround(points[i], center, cosAngle, sinAngle);
 		}
 	}
 
@@ -1238,12 +2223,13 @@ namespace LinaVG
 		// const float midAngle	  = (angle2 + angle1) / 2.0f;
 		const float angleIncrease = (segments >= 180.0f || segments < 0.0f) ? 1.0f : 180.0f / (float)segments;
 
+		ArcStepper arc(center, halfMag, angle1 + angleIncrease + angleOffset, angleIncrease);
 		for (float i = angle1 + angleIncrease + angleOffset; i < angle2 - angleOffset; i += angleIncrease)
 		{
 			Vec2 p = Vec2(0, 0);
 
 			if (Math::IsEqualMarg(radius, 0.0f))
-				p = Math::GetPointOnCircle(center, halfMag, i);
+				p = arc.Next();
 			else
 			{
 				const Vec2 out = Math::Normalized(Math::Rotate90(dir, !flip));
@@ -1270,66 +2256,38 @@ namespace LinaVG
 		{
 			if (points[i].x < outMin.x)
 				outMin.x = points[i].x;
-			else if (points[i].x > outMax.x)
+			if (points[i].x > outMax.x)
 				outMax.x = points[i].x;
 			if (points[i].y < outMin.y)
 				outMin.y = points[i].y;
-			else if (points[i].y > outMax.y)
+			if (points[i].y > outMax.y)
 				outMax.y = points[i].y;
 		}
 	}
 
 	void Drawer::GetConvexBoundingBox(Vertex* points, int size, Vec2& outMin, Vec2& outMax)
 	{
-		outMin = Vec2(99999, 99999);
-		outMax = Vec2(-99999, -99999);
-
-		for (int i = 0; i < size; i++)
-		{
-			if (points[i].pos.x < outMin.x)
-				outMin.x = points[i].pos.x;
-			else if (points[i].pos.x > outMax.x)
-				outMax.x = points[i].pos.x;
-			if (points[i].pos.y < outMin.y)
-				outMin.y = points[i].pos.y;
-			else if (points[i].pos.y > outMax.y)
-				outMax.y = points[i].pos.y;
-		}
+		Utility::GetVerticesBoundingBox(points, size, outMin, outMax);
 	}
 
 	void Drawer::GetConvexBoundingBox(DrawBuffer* buf, int startIndex, int endIndex, Vec2& outMin, Vec2& outMax)
 	{
-		outMin = Vec2(99999, 99999);
-		outMax = Vec2(-99999, -99999);
-
-		for (int i = startIndex; i < endIndex + 1; i++)
-		{
-			if (buf->vertexBuffer[i].pos.x < outMin.x)
-				outMin.x = buf->vertexBuffer[i].pos.x;
-			else if (buf->vertexBuffer[i].pos.x > outMax.x)
-				outMax.x = buf->vertexBuffer[i].pos.x;
-			if (buf->vertexBuffer[i].pos.y < outMin.y)
-				outMin.y = buf->vertexBuffer[i].pos.y;
-			else if (buf->vertexBuffer[i].pos.y > outMax.y)
-				outMax.y = buf->vertexBuffer[i].pos.y;
-		}
+		Utility::GetVerticesBoundingBox(buf->vertexBuffer.m_data + startIndex, endIndex - startIndex + 1, outMin, outMax);
 	}
 
 	void Drawer::CalculateVertexUVs(DrawBuffer* buf, int startIndex, int endIndex)
 	{
 		Vec2 bbMin, bbMax;
 		GetConvexBoundingBox(&buf->vertexBuffer.m_data[startIndex], endIndex - startIndex + 1, bbMin, bbMax);
-
-		// Recalculate UVs.
-		for (int i = startIndex; i <= endIndex; i++)
-		{
-			buf->vertexBuffer[i].uv.x = Math::Remap(buf->vertexBuffer[i].pos.x, bbMin.x, bbMax.x, 0.0f, 1.0f);
-			buf->vertexBuffer[i].uv.y = Math::Remap(buf->vertexBuffer[i].pos.y, bbMin.y, bbMax.y, 0.0f, 1.0f);
-		}
+		Utility::CalculateVertexUVs(buf->vertexBuffer.m_data + startIndex, endIndex - startIndex + 1, bbMin, bbMax);
 	}
 
-	float Drawer::GetAngleIncrease(float rounding)
+	float Drawer::GetAngleIncrease(float rounding, float radius)
 	{
+		// Splits the 90 degree corner evenly, corner loops overshoot their end angle by 2.5 degrees so steps stay above that.
+		if (Config.flatnessTolerance > 0.0f)
+			return 90.0f / static_cast<float>(GetToleranceSegments(radius, 90.0f, 1, 30));
+
 		if (rounding < 0.25f)
 			return 20.0f;
 		else if (rounding < 0.5f)
@@ -1340,6 +2298,29 @@ namespace LinaVG
 			return 5.0f;
 	}
 
+	int Drawer::GetRoundedRectVertexCount(const Vec2& min, const Vec2& max, const StyleOptions& style)
+	{
+		Vertex v[4];
+		FillRectData(v, false, min, max);
+
+		// Same corner radius as FillRect_Round, its corner loops step from 180 up to 272.5 degrees, plus a step of float drift.
+		const float verticalMag	  = Math::Mag(Vec2(v[0].pos.x - v[3].pos.x, v[0].pos.y - v[3].pos.y));
+		const float horizontalMag = Math::Mag(Vec2(v[1].pos.x - v[0].pos.x, v[1].pos.y - v[0].pos.y));
+		const float rounding	  = Math::Clamp(style.rounding, 0.0f, 0.9f);
+		const float roundingMag	  = rounding * Math::Min(verticalMag, horizontalMag) / 2.0f;
+		const int	cornerCount	  = static_cast<int>(92.5f / GetAngleIncrease(rounding, roundingMag)) + 2;
+		return GetFillVertexCount(cornerCount * 4, style.isFilled);
+	}
+
+	int Drawer::GetRoundedTriVertexCount(const Vec2& top, const Vec2& right, const Vec2& left, const StyleOptions& style)
+	{
+		// Corner arcs of FillTri_Round span half circles no wider than the rounding magnitude, their points are the segments, both ends & a step of float drift.
+		const float shortestEdgeMag = Math::Min(Math::Min(Math::Mag(Vec2(top.x - right.x, top.y - right.y)), Math::Mag(Vec2(top.x - left.x, top.y - left.y))), Math::Mag(Vec2(right.x - left.x, right.y - left.y)));
+		const float roundingMag		= Math::Clamp(style.rounding, 0.0f, 1.0f) * shortestEdgeMag / 2.0f;
+		const int	cornerCount		= static_cast<int>(GetCornerArcSegments(roundingMag)) + 3;
+		return GetFillVertexCount(cornerCount * 3, style.isFilled);
+	}
+
 	Vec2 Drawer::GetArcDirection(const Vec2& center, float radius, float startAngle, float endAngle)
 	{
 		const Vec2 centerAnglePoint = Math::GetPointOnCircle(center, radius, (startAngle + endAngle) / 2.0f);
@@ -1367,164 +2348,353 @@ namespace LinaVG
 		return point.x > rect.x && point.x < (rect.x + rect.z) && point.y > rect.y && point.y < (rect.y + rect.w);
 	}
 
-	void Drawer::CalculateLine(Line& line, const Vec2& p1, const Vec2& p2, StyleOptions& style, LineCapDirection lineCapToAdd)
+	void Drawer::StrokeLines(LineStroke& stroke, Vec2* points, int count, int firstSegment, int endSegment, bool useEntry, const StyleOptions& opts, StyleOptions& style, LineCapDirection cap, LineJointType jointType, bool addUpperLowerIndices)
 	{
-		const Vec2 up = Math::Normalized(Math::Rotate90(Vec2(p2.x - p1.x, p2.y - p1.y), true));
-		Vertex	   v0, v1, v2, v3;
-
-		v0.pos = Vec2(p1.x + up.x * style.thickness.start / 2.0f, p1.y + up.y * style.thickness.start / 2.0f);
-		v3.pos = Vec2(p1.x - up.x * style.thickness.start / 2.0f, p1.y - up.y * style.thickness.start / 2.0f);
-		v1.pos = Vec2(p2.x + up.x * style.thickness.end / 2.0f, p2.y + up.y * style.thickness.end / 2.0f);
-		v2.pos = Vec2(p2.x - up.x * style.thickness.end / 2.0f, p2.y - up.y * style.thickness.end / 2.0f);
-		v0.col = v3.col = style.color.start;
-		v1.col = v2.col = style.color.end;
-		line.m_vertices.push_back(v0);
-		line.m_vertices.push_back(v1);
-		line.m_vertices.push_back(v2);
-		line.m_vertices.push_back(v3);
-
-		const Vec2 upRaw		  = Vec2(v0.pos.x - v3.pos.x, v0.pos.y - v3.pos.y);
-		const bool willAddLineCap = lineCapToAdd == LineCapDirection::Left || lineCapToAdd == LineCapDirection::Right;
+		DrawBuffer* buf			= stroke.buf;
+		const int	vertexStart = buf->vertexBuffer.m_size;
+		const int	indexStart	= buf->indexBuffer.m_size;
+		stroke.upperIndices.shrink(0);
+		stroke.lowerIndices.shrink(0);
 
-		if (willAddLineCap)
-		{
-			Vertex vmLeft, vmRight;
-			vmLeft.pos	= Math::Lerp(v0.pos, v3.pos, 0.5f);
-			vmRight.pos = Math::Lerp(v1.pos, v2.pos, 0.5f);
-			vmLeft.col	= style.color.start;
-			vmRight.col = style.color.end;
-			line.m_vertices.push_back(vmLeft);
-			line.m_vertices.push_back(vmRight);
-			line.m_hasMidpoints = true;
-		}
+		// Sliding window, the previous segment is already written & its end gets joined with the current one before writing it.
+		LineSegment		 segments[2];
+		LineCapDirection usedCapDir	  = LineCapDirection::None;
+		const int		 startSegment = useEntry ? firstSegment : Math::Max(0, firstSegment - LINE_CHUNK_WARMUP);
 
-		if (willAddLineCap)
+		for (int i = startSegment; i < count - 1; i++)
 		{
-			const Vertex* upVtx	  = lineCapToAdd == LineCapDirection::Left ? &v0 : &v1;
-			const Vertex* downVtx = lineCapToAdd == LineCapDirection::Left ? &v3 : &v2;
+			LineSegment& prev = segments[(i + 1) % 2];
+			LineSegment& curr = segments[i % 2];
+
+			if (i == 0 && (cap == LineCapDirection::Left || cap == LineCapDirection::Both))
+				usedCapDir = LineCapDirection::Left;
+			else if (i == count - 2 && (cap == LineCapDirection::Right || cap == LineCapDirection::Both))
+				usedCapDir = LineCapDirection::Right;
+			else
+				usedCapDir = LineCapDirection::None;
+
+			if (useEntry && i == firstSegment)
+			{
+				curr = stroke.entry;
+				WriteLineSegment(stroke, curr, style, usedCapDir, addUpperLowerIndices);
+				continue;
+			}
 
-			const float increase = Math::Remap(style.rounding, 0.0f, 1.0f, 0.4f, 0.1f);
-			const float radius	 = (Math::Mag(upRaw) / 2.0f) * 0.6f;
-			const Vec2	dir		 = Math::Rotate90(up, lineCapToAdd == LineCapDirection::Left);
+			const float t		  = static_cast<float>(i) / static_cast<float>(count - 1);
+			const float t2		  = static_cast<float>(i + 1) / static_cast<float>(count - 1);
+			style.thickness.start = Math::Lerp(opts.thickness.start, opts.thickness.end, t);
+			style.thickness.end	  = Math::Lerp(opts.thickness.start, opts.thickness.end, t2);
 
-			Array<int> upperParabolaPoints;
-			Array<int> lowerParabolaPoints;
+			CalculateLineSegment(curr, points[i], points[i + 1], style);
 
-			for (float k = 0.0f + increase; k < 1.0f; k += increase)
+			if (i > startSegment)
 			{
-				const Vec2 p = Math::SampleParabola(upVtx->pos, downVtx->pos, dir, radius, k);
-				Vertex	   v;
-				v.col = lineCapToAdd == LineCapDirection::Left ? style.color.start : style.color.end;
-				v.pos = p;
+				const Vertex* written = &buf->vertexBuffer[prev.m_base];
+				const Vec2	  currDir = Math::Normalized(Vec2(written[2].pos.x - written[3].pos.x, written[2].pos.y - written[3].pos.y));
+				const Vec2	  nextDir = Math::Normalized(Vec2(curr.m_corners[2].pos.x - curr.m_corners[3].pos.x, curr.m_corners[2].pos.y - curr.m_corners[3].pos.y));
+
+				if (!Math::AreLinesParallel(written[3].pos, written[2].pos, curr.m_corners[3].pos, curr.m_corners[2].pos))
+				{
+					// If next line is going below current one, angle is positive, and we merge lower vertices while joining upper.
+					// Vice versa if angle is negative
+					const float angle = Math::GetAngleBetweenDirs(currDir, nextDir);
 
-				line.m_vertices.push_back(v);
-				line.m_lineCapVertexCount++;
+					LineJointType usedJointType = jointType;
 
-				const float distToUp   = Math::Mag(Vec2(upVtx->pos.x - p.x, upVtx->pos.y - p.y));
-				const float distToDown = Math::Mag(Vec2(downVtx->pos.x - p.x, downVtx->pos.y - p.y));
+					if (jointType != LineJointType::VtxAverage)
+					{
+						if (Math::Abs(angle) < 15.0f)
+							usedJointType = LineJointType::VtxAverage;
+						else
+						{
+							// Joint type fallbacks.
+							if (jointType == LineJointType::Miter && Math::Abs(angle) > Config.miterLimit)
+								usedJointType = LineJointType::BevelRound;
+
+							if (jointType == LineJointType::BevelRound && Math::IsEqualMarg(style.rounding, 0.0f))
+								usedJointType = LineJointType::Bevel;
+						}
+					}
 
-				if (distToUp < distToDown)
-					upperParabolaPoints.push_back(line.m_vertices.m_size - 1);
+					JoinLineSegments(stroke, prev, curr, style, usedJointType, angle < 0.0f, addUpperLowerIndices);
+				}
 				else
-					lowerParabolaPoints.push_back(line.m_vertices.m_size - 1);
+				{
+					curr.m_skipUpperStart = true;
+					curr.m_skipLowerStart = true;
+				}
 			}
 
-			if (lineCapToAdd == LineCapDirection::Left)
+			if (i == endSegment)
 			{
+				stroke.exit = curr;
+				return;
+			}
+
+			// Discard the warmup segments, the joint to the previous chunk included.
+			if (i == firstSegment)
+			{
+				buf->vertexBuffer.shrink(vertexStart);
+				buf->indexBuffer.shrink(indexStart);
+				stroke.upperIndices.shrink(0);
+				stroke.lowerIndices.shrink(0);
+				stroke.entry = curr;
+			}
+
+			WriteLineSegment(stroke, curr, style, usedCapDir, addUpperLowerIndices);
+		}
+	}
 
-				for (int i = upperParabolaPoints.m_size - 1; i > -1; i--)
-					line.m_upperIndices.push_back(upperParabolaPoints[i]);
+	int Drawer::StrokeLineChunks(Vec2* points, int count, int firstSegment, int endSegment, const StyleOptions& opts, LineCapDirection cap, LineJointType jointType, bool addUpperLowerIndices)
+	{
+		const int segmentCount = endSegment - firstSegment;
+
+		// Chunking only depends on the point count, seams are checked against serial stroking regardless of scheduling.
+		int chunkSize = Config.lineChunkSize < 1 ? 1 : Config.lineChunkSize;
+		if ((segmentCount + chunkSize - 1) / chunkSize > LINE_MAX_CHUNKS)
+			chunkSize = (segmentCount + LINE_MAX_CHUNKS - 1) / LINE_MAX_CHUNKS;
+
+		const int chunkCount = (segmentCount + chunkSize - 1) / chunkSize;
+
+		while (static_cast<int>(m_lineChunks.size()) < chunkCount)
+			m_lineChunks.push_back(new LineChunk());
+
+		m_lineChunksUsed = chunkCount;
+
+		auto strokeChunk = [&](LineChunk* chunk, bool useEntry) {
+			StyleOptions style = StyleOptions(opts);
+			style.isFilled	   = true;
+			chunk->stroke.buf  = &chunk->buffer;
+			chunk->buffer.vertexBuffer.shrink(0);
+			chunk->buffer.indexBuffer.shrink(0);
+			StrokeLines(chunk->stroke, points, count, chunk->firstSegment, chunk->endSegment, useEntry, opts, style, cap, jointType, addUpperLowerIndices);
+			Utility::GetVerticesBoundingBox(chunk->buffer.vertexBuffer.m_data, chunk->buffer.vertexBuffer.m_size, chunk->bbMin, chunk->bbMax);
+		};
+
+		RunParallel(chunkCount, [&](int i) {
+			LineChunk* chunk	= m_lineChunks[i];
+			chunk->firstSegment = firstSegment + i * chunkSize;
+			chunk->endSegment	= Math::Min(chunk->firstSegment + chunkSize, endSegment);
+			strokeChunk(chunk, false);
+		});
 
-				line.m_upperIndices.push_back(0);
-				line.m_upperIndices.push_back(1);
+		// Each chunk has to start from the state the previous one hands over, restroke it from there otherwise.
+		int vertexCount = 0;
+		int indexCount	= 0;
+		int upperCount	= 0;
+		int lowerCount	= 0;
 
-				for (int i = 0; i < lowerParabolaPoints.m_size; i++)
-					line.m_lowerIndices.push_back(lowerParabolaPoints[i]);
+		for (int i = 0; i < chunkCount; i++)
+		{
+			LineChunk* chunk = m_lineChunks[i];
 
-				line.m_lowerIndices.push_back(3);
-				line.m_lowerIndices.push_back(2);
+			if (i > 0 && !IsSameLineEntry(m_lineChunks[i - 1]->stroke.exit, chunk->stroke.entry))
+			{
+				chunk->stroke.entry = m_lineChunks[i - 1]->stroke.exit;
+				strokeChunk(chunk, true);
 			}
-			else
+
+			chunk->vertexOffset = vertexCount;
+			chunk->indexOffset	= indexCount;
+			chunk->upperOffset	= upperCount;
+			chunk->lowerOffset	= lowerCount;
+			vertexCount += chunk->buffer.vertexBuffer.m_size;
+			indexCount += chunk->buffer.indexBuffer.m_size;
+			upperCount += chunk->stroke.upperIndices.m_size;
+			lowerCount += chunk->stroke.lowerIndices.m_size;
+		}
+
+		return vertexCount;
+	}
+
+	void Drawer::WriteLineChunks(DrawBuffer* buf, const Vec4Grad& color)
+	{
+		const LineChunk* last		 = m_lineChunks[m_lineChunksUsed - 1];
+		const int		 vertexStart = buf->vertexBuffer.m_size;
+		const int		 indexStart	 = buf->indexBuffer.m_size;
+		Vec2			 bbMin		 = m_lineChunks[0]->bbMin;
+		Vec2			 bbMax		 = m_lineChunks[0]->bbMax;
+
+		for (int i = 1; i < m_lineChunksUsed; i++)
+		{
+			bbMin.x = Math::Min(bbMin.x, m_lineChunks[i]->bbMin.x);
+			bbMin.y = Math::Min(bbMin.y, m_lineChunks[i]->bbMin.y);
+			bbMax.x = Math::Max(bbMax.x, m_lineChunks[i]->bbMax.x);
+			bbMax.y = Math::Max(bbMax.y, m_lineChunks[i]->bbMax.y);
+		}
+
+		buf->vertexBuffer.resize(vertexStart + last->vertexOffset + last->buffer.vertexBuffer.m_size);
+		buf->indexBuffer.resize(indexStart + last->indexOffset + last->buffer.indexBuffer.m_size);
+		m_lineStroke.upperIndices.resize(last->upperOffset + last->stroke.upperIndices.m_size);
+		m_lineStroke.lowerIndices.resize(last->lowerOffset + last->stroke.lowerIndices.m_size);
+
+		RunParallel(m_lineChunksUsed, [&](int i) {
+			const LineChunk* chunk		 = m_lineChunks[i];
+			const int		 vertexCount = chunk->buffer.vertexBuffer.m_size;
+			const int		 baseVertex	 = vertexStart + chunk->vertexOffset;
+			Vertex*			 vertices	 = buf->vertexBuffer.m_data + baseVertex;
+
+			LINAVG_MEMCPY(vertices, chunk->buffer.vertexBuffer.m_data, sizeof(Vertex) * vertexCount);
+			Utility::CalculateVertexUVsAndColors(vertices, vertexCount, bbMin, bbMax, color, false);
+			Utility::RebaseIndices(buf->indexBuffer.m_data + indexStart + chunk->indexOffset, chunk->buffer.indexBuffer.m_data, chunk->buffer.indexBuffer.m_size, baseVertex);
+
+			for (int j = 0; j < chunk->stroke.upperIndices.m_size; j++)
+				m_lineStroke.upperIndices[chunk->upperOffset + j] = baseVertex + chunk->stroke.upperIndices[j];
+
+			for (int j = 0; j < chunk->stroke.lowerIndices.m_size; j++)
+				m_lineStroke.lowerIndices[chunk->lowerOffset + j] = baseVertex + chunk->stroke.lowerIndices[j];
+		});
+	}
+
+	void Drawer::CalculateLineSegment(LineSegment& segment, const Vec2& p1, const Vec2& p2, StyleOptions& style)
+	{
+		const Vec2 up = Math::Normalized(Math::Rotate90(Vec2(p2.x - p1.x, p2.y - p1.y), true));
+		Vertex*	   v  = segment.m_corners;
+
+		v[0] = v[1] = v[2] = v[3] = Vertex();
+		v[0].pos				  = Vec2(p1.x + up.x * style.thickness.start / 2.0f, p1.y + up.y * style.thickness.start / 2.0f);
+		v[3].pos				  = Vec2(p1.x - up.x * style.thickness.start / 2.0f, p1.y - up.y * style.thickness.start / 2.0f);
+		v[1].pos				  = Vec2(p2.x + up.x * style.thickness.end / 2.0f, p2.y + up.y * style.thickness.end / 2.0f);
+		v[2].pos				  = Vec2(p2.x - up.x * style.thickness.end / 2.0f, p2.y - up.y * style.thickness.end / 2.0f);
+		v[0].col = v[3].col = style.color.start;
+		v[1].col = v[2].col = style.color.end;
+
+		// Caps are fit to the corners before any joints move them.
+		segment.m_up			 = up;
+		segment.m_startMid		 = Math::Lerp(v[0].pos, v[3].pos, 0.5f);
+		segment.m_endMid		 = Math::Lerp(v[1].pos, v[2].pos, 0.5f);
+		segment.m_width			 = Math::Mag(Vec2(v[0].pos.x - v[3].pos.x, v[0].pos.y - v[3].pos.y));
+		segment.m_base			 = 0;
+		segment.m_vertexCount	 = 0;
+		segment.m_skipUpperStart = false;
+		segment.m_skipLowerStart = false;
+	}
+
+	void Drawer::WriteLineSegment(LineStroke& stroke, LineSegment& segment, StyleOptions& style, LineCapDirection lineCapToAdd, bool addUpperLowerIndices)
+	{
+		DrawBuffer* buf	 = stroke.buf;
+		const int	base = buf->vertexBuffer.m_size;
+		segment.m_base = base;
+
+		for (int i = 0; i < 4; i++)
+			buf->PushVertex(segment.m_corners[i]);
+
+		const bool willAddLineCap = lineCapToAdd == LineCapDirection::Left || lineCapToAdd == LineCapDirection::Right;
+
+		if (!willAddLineCap)
+		{
+			segment.m_vertexCount = 4;
+			PushTriangle(buf, base, 0, 1, 3);
+			PushTriangle(buf, base, 1, 2, 3);
+
+			if (addUpperLowerIndices)
 			{
-				line.m_upperIndices.push_back(0);
-				line.m_upperIndices.push_back(1);
+				if (!segment.m_skipUpperStart)
+					stroke.upperIndices.push_back(base);
 
-				for (int i = 0; i < upperParabolaPoints.m_size; i++)
-					line.m_upperIndices.push_back(upperParabolaPoints[i]);
+				stroke.upperIndices.push_back(base + 1);
 
-				line.m_lowerIndices.push_back(3);
-				line.m_lowerIndices.push_back(2);
+				if (!segment.m_skipLowerStart)
+					stroke.lowerIndices.push_back(base + 3);
 
-				for (int i = lowerParabolaPoints.m_size - 1; i > -1; i--)
-					line.m_lowerIndices.push_back(lowerParabolaPoints[i]);
+				stroke.lowerIndices.push_back(base + 2);
 			}
+
+			return;
 		}
-		else
+
+		const bool isLeft = lineCapToAdd == LineCapDirection::Left;
+
+		Vertex vmLeft, vmRight;
+		vmLeft.pos	= segment.m_startMid;
+		vmRight.pos = segment.m_endMid;
+		vmLeft.col	= style.color.start;
+		vmRight.col = style.color.end;
+		buf->PushVertex(vmLeft);
+		buf->PushVertex(vmRight);
+
+		// Left caps are only added to the first segment & right caps to the last one, so the corners they fit to are never joined.
+		const Vec2	upPos	= isLeft ? segment.m_corners[0].pos : segment.m_corners[1].pos;
+		const Vec2	downPos = isLeft ? segment.m_corners[3].pos : segment.m_corners[2].pos;
+		const float radius	= segment.m_width / 2.0f;
+
+		const float increase = Config.flatnessTolerance > 0.0f ? 1.0f / static_cast<float>(GetToleranceSegments(radius, 180.0f, 2, 20)) : Math::Remap(style.rounding, 0.0f, 1.0f, 0.4f, 0.1f);
+		const Vec2	dir		 = Math::Rotate90(segment.m_up, isLeft);
+
+		for (float k = 0.0f + increase; k < 1.0f; k += increase)
 		{
-			line.m_upperIndices.push_back(0);
-			line.m_upperIndices.push_back(1);
-			line.m_lowerIndices.push_back(3);
-			line.m_lowerIndices.push_back(2);
-		}
-
-		// Draw 4 triangles if there are middle vertices.
-		// Draw 2 if no middle vertices.
-		if (willAddLineCap)
-		{
-			LineTriangle tri1, tri2, tri3, tri4;
-			tri1.m_indices[0] = 0;
-			tri1.m_indices[1] = 1;
-			tri1.m_indices[2] = 4;
-			tri2.m_indices[0] = 1;
-			tri2.m_indices[1] = 4;
-			tri2.m_indices[2] = 5;
-			tri3.m_indices[0] = 4;
-			tri3.m_indices[1] = 5;
-			tri3.m_indices[2] = 3;
-			tri4.m_indices[0] = 5;
-			tri4.m_indices[1] = 2;
-			tri4.m_indices[2] = 3;
-			line.m_tris.push_back(tri1);
-			line.m_tris.push_back(tri2);
-			line.m_tris.push_back(tri3);
-			line.m_tris.push_back(tri4);
+			Vertex v;
+			v.col = isLeft ? style.color.start : style.color.end;
+			v.pos = Math::SampleParabola(upPos, downPos, dir, radius * 0.6f, k);
+			buf->PushVertex(v);
 		}
-		else
+
+		const int vertexCount = buf->vertexBuffer.m_size - base;
+		segment.m_vertexCount = vertexCount;
+
+		PushTriangle(buf, base, 0, 1, 4);
+		PushTriangle(buf, base, 1, 4, 5);
+		PushTriangle(buf, base, 4, 5, 3);
+		PushTriangle(buf, base, 5, 2, 3);
+
+		// Triangles for cap vertices, from its start & end to the middle, then fanning around it.
+		const int middleIndex = isLeft ? 4 : 5;
+		PushTriangle(buf, base, isLeft ? 0 : 1, 6, middleIndex);
+		PushTriangle(buf, base, isLeft ? 3 : 2, vertexCount - 1, middleIndex);
+
+		for (int i = 6; i < vertexCount - 1; i++)
+			PushTriangle(buf, base, i, i + 1, middleIndex);
+
+		if (!addUpperLowerIndices)
+			return;
+
+		// Cap vertices go along the side they are closer to, the upper side ordered from start to end as well.
+		const Vertex* capVertices = &buf->vertexBuffer[base];
+		auto		  isUpper	  = [&](int i) {
+			   const Vec2& p = capVertices[i].pos;
+			   return Math::Mag(Vec2(upPos.x - p.x, upPos.y - p.y)) < Math::Mag(Vec2(downPos.x - p.x, downPos.y - p.y));
+		};
+
+		if (isLeft)
+		{
+			for (int i = vertexCount - 1; i > 5; i--)
+			{
+				if (isUpper(i))
+					stroke.upperIndices.push_back(base + i);
+			}
+		}
+
+		if (!segment.m_skipUpperStart)
+			stroke.upperIndices.push_back(base);
+
+		stroke.upperIndices.push_back(base + 1);
+
+		if (isLeft)
 		{
-			LineTriangle tri1, tri2;
-			tri1.m_indices[0] = 0;
-			tri1.m_indices[1] = 1;
-			tri1.m_indices[2] = 3;
-			tri2.m_indices[0] = 1;
-			tri2.m_indices[1] = 2;
-			tri2.m_indices[2] = 3;
-			line.m_tris.push_back(tri1);
-			line.m_tris.push_back(tri2);
+			for (int i = 6; i < vertexCount; i++)
+			{
+				if (!isUpper(i))
+					stroke.lowerIndices.push_back(base + i);
+			}
 		}
 
-		// Triangles for cap vertices.
-		if (willAddLineCap)
+		if (!segment.m_skipLowerStart)
+			stroke.lowerIndices.push_back(base + 3);
+
+		stroke.lowerIndices.push_back(base + 2);
+
+		if (!isLeft)
 		{
-			const int	 middleIndex = lineCapToAdd == LineCapDirection::Left ? 4 : 5;
-			const int	 upperIndex	 = lineCapToAdd == LineCapDirection::Left ? 0 : 1;
-			const int	 lowerIndex	 = lineCapToAdd == LineCapDirection::Left ? 3 : 2;
-			LineTriangle tri1, tri2; // start / end.
-			tri1.m_indices[0] = upperIndex;
-			tri1.m_indices[1] = 6; // start of cap rounding.
-			tri1.m_indices[2] = middleIndex;
-			tri2.m_indices[0] = lowerIndex;
-			tri2.m_indices[1] = line.m_vertices.m_size - 1; // end of cap rounding.
-			tri2.m_indices[2] = middleIndex;
-			line.m_tris.push_back(tri1);
-			line.m_tris.push_back(tri2);
+			for (int i = 6; i < vertexCount; i++)
+			{
+				if (isUpper(i))
+					stroke.upperIndices.push_back(base + i);
+			}
 
-			for (int i = 6; i < line.m_vertices.m_size - 1; i++)
+			for (int i = vertexCount - 1; i > 5; i--)
 			{
-				LineTriangle tri;
-				tri.m_indices[0] = i;
-				tri.m_indices[1] = i + 1;
-				tri.m_indices[2] = middleIndex;
-				line.m_tris.push_back(tri);
+				if (!isUpper(i))
+					stroke.lowerIndices.push_back(base + i);
 			}
 		}
 	}
@@ -1541,35 +2711,29 @@ namespace LinaVG
 		return line;
 	}
 
-	void Drawer::JoinLines(Line& line1, Line& line2, StyleOptions& opts, LineJointType jointType, bool mergeUpperVertices)
+	void Drawer::JoinLineSegments(LineStroke& stroke, LineSegment& prev, LineSegment& next, StyleOptions& opts, LineJointType jointType, bool mergeUpperVertices, bool addUpperLowerIndices)
 	{
-		const bool addUpperLowerIndices = opts.aaEnabled || !Math::IsEqualMarg(opts.outlineOptions.thickness, 0.0f);
+		// Previous segment's vertices are moved in place, pointer is invalid after pushing to buf.
+		DrawBuffer* buf = stroke.buf;
+		Vertex*		l1	= &buf->vertexBuffer[prev.m_base];
+		Vertex*		l2	= next.m_corners;
 
 		if (jointType == LineJointType::VtxAverage)
 		{
-			const Vec2 upperAvg = Vec2((line1.m_vertices[1].pos.x + line2.m_vertices[0].pos.x) / 2.0f, (line1.m_vertices[1].pos.y + line2.m_vertices[0].pos.y) / 2.0f);
-			const Vec2 lowerAvg = Vec2((line1.m_vertices[2].pos.x + line2.m_vertices[3].pos.x) / 2.0f, (line1.m_vertices[2].pos.y + line2.m_vertices[3].pos.y) / 2.0f);
-
-			line1.m_vertices[1].pos = line2.m_vertices[0].pos = upperAvg;
-			line1.m_vertices[2].pos = line2.m_vertices[3].pos = lowerAvg;
+			const Vec2 upperAvg = Vec2((l1[1].pos.x + l2[0].pos.x) / 2.0f, (l1[1].pos.y + l2[0].pos.y) / 2.0f);
+			const Vec2 lowerAvg = Vec2((l1[2].pos.x + l2[3].pos.x) / 2.0f, (l1[2].pos.y + l2[3].pos.y) / 2.0f);
 
-			if (addUpperLowerIndices)
-			{
-				line2.m_upperIndices.erase(line2.m_upperIndices.findAddr(0));
-				line2.m_lowerIndices.erase(line2.m_lowerIndices.findAddr(3));
-			}
+			l1[1].pos = l2[0].pos = upperAvg;
+			l1[2].pos = l2[3].pos = lowerAvg;
+			next.m_skipUpperStart = next.m_skipLowerStart = true;
 		}
 		else if (jointType == LineJointType::Miter)
 		{
-			const Vec2 upperIntersection = Math::LineIntersection(line1.m_vertices[0].pos, line1.m_vertices[1].pos, line2.m_vertices[0].pos, line2.m_vertices[1].pos);
-			const Vec2 lowerIntersection = Math::LineIntersection(line1.m_vertices[3].pos, line1.m_vertices[2].pos, line2.m_vertices[3].pos, line2.m_vertices[2].pos);
-			line1.m_vertices[1].pos = line2.m_vertices[0].pos = upperIntersection;
-			line1.m_vertices[2].pos = line2.m_vertices[3].pos = lowerIntersection;
-			if (addUpperLowerIndices)
-			{
-				line2.m_upperIndices.erase(line2.m_upperIndices.findAddr(0));
-				line2.m_lowerIndices.erase(line2.m_lowerIndices.findAddr(3));
-			}
+			const Vec2 upperIntersection = Math::LineIntersection(l1[0].pos, l1[1].pos, l2[0].pos, l2[1].pos);
+			const Vec2 lowerIntersection = Math::LineIntersection(l1[3].pos, l1[2].pos, l2[3].pos, l2[2].pos);
+			l1[1].pos = l2[0].pos = upperIntersection;
+			l1[2].pos = l2[3].pos = lowerIntersection;
+			next.m_skipUpperStart = next.m_skipLowerStart = true;
 		}
 		else if (jointType == LineJointType::Bevel)
 		{
@@ -1578,28 +2742,22 @@ namespace LinaVG
 			const int intersection2 = mergeUpperVertices ? 2 : 1;
 			const int intersection3 = mergeUpperVertices ? 3 : 0;
 
-			if (addUpperLowerIndices)
-			{
-				if (mergeUpperVertices)
-					line2.m_upperIndices.erase(line2.m_upperIndices.findAddr(0));
-				else
-					line2.m_lowerIndices.erase(line2.m_lowerIndices.findAddr(3));
-			}
+			if (mergeUpperVertices)
+				next.m_skipUpperStart = true;
+			else
+				next.m_skipLowerStart = true;
 
-			const Vec2 intersection				= Math::LineIntersection(line1.m_vertices[intersection0].pos, line1.m_vertices[intersection1].pos, line2.m_vertices[intersection0].pos, line2.m_vertices[intersection1].pos);
-			line1.m_vertices[intersection1].pos = line2.m_vertices[intersection0].pos = intersection;
+			const Vec2 intersection = Math::LineIntersection(l1[intersection0].pos, l1[intersection1].pos, l2[intersection0].pos, l2[intersection1].pos);
+			l1[intersection1].pos = l2[intersection0].pos = intersection;
 
-			const int vLowIndex = line1.m_vertices.m_size;
+			const int vLowIndex = prev.m_vertexCount;
 			Vertex	  vLow;
 			vLow.col = opts.color.start;
-			vLow.pos = line2.m_vertices[intersection3].pos;
-			line1.m_vertices.push_back(vLow);
+			vLow.pos = l2[intersection3].pos;
+			buf->PushVertex(vLow);
+			prev.m_vertexCount++;
 
-			LineTriangle tri1;
-			tri1.m_indices[0] = intersection1;
-			tri1.m_indices[1] = intersection2;
-			tri1.m_indices[2] = vLowIndex;
-			line1.m_tris.push_back(tri1);
+			PushTriangle(buf, prev.m_base, intersection1, intersection2, vLowIndex);
 		}
 		else if (jointType == LineJointType::BevelRound)
 		{
@@ -1607,129 +2765,78 @@ namespace LinaVG
 			const int	intersection1	   = mergeUpperVertices ? 1 : 2;
 			const int	intersection2	   = mergeUpperVertices ? 2 : 1;
 			const int	intersection3	   = mergeUpperVertices ? 3 : 0;
-			const Vec2	upperIntersection  = Math::LineIntersection(line1.m_vertices[intersection0].pos, line1.m_vertices[intersection1].pos, line2.m_vertices[intersection0].pos, line2.m_vertices[intersection1].pos);
-			const Vec2	lowerIntersection  = Math::LineIntersection(line1.m_vertices[intersection3].pos, line1.m_vertices[intersection2].pos, line2.m_vertices[intersection3].pos, line2.m_vertices[intersection2].pos);
+			const Vec2	upperIntersection  = Math::LineIntersection(l1[intersection0].pos, l1[intersection1].pos, l2[intersection0].pos, l2[intersection1].pos);
+			const Vec2	lowerIntersection  = Math::LineIntersection(l1[intersection3].pos, l1[intersection2].pos, l2[intersection3].pos, l2[intersection2].pos);
 			const Vec2	intersectionCenter = Vec2((upperIntersection.x + lowerIntersection.x) / 2.0f, (upperIntersection.y + lowerIntersection.y) / 2.0f);
-			const float ang2			   = Math::GetAngleFromCenter(intersectionCenter, line1.m_vertices[intersection2].pos);
-			const float ang1			   = Math::GetAngleFromCenter(intersectionCenter, line2.m_vertices[intersection3].pos);
+			const float ang2			   = Math::GetAngleFromCenter(intersectionCenter, l1[intersection2].pos);
+			const float ang1			   = Math::GetAngleFromCenter(intersectionCenter, l2[intersection3].pos);
 			const float startAngle		   = ang2 > ang1 ? ang1 : ang2;
 			const float endAngle		   = ang2 > ang1 ? ang2 : ang1;
-			const float arcRad			   = Math::Mag(Vec2(line1.m_vertices[intersection2].pos.x - intersectionCenter.x, line1.m_vertices[intersection2].pos.y - intersectionCenter.y));
+			const float arcRad			   = Math::Mag(Vec2(l1[intersection2].pos.x - intersectionCenter.x, l1[intersection2].pos.y - intersectionCenter.y));
 
 			// Merge
-			line1.m_vertices[intersection1].pos = line2.m_vertices[intersection0].pos = upperIntersection;
+			l1[intersection1].pos = l2[intersection0].pos = upperIntersection;
 
-			if (addUpperLowerIndices)
-			{
-				if (mergeUpperVertices)
-					line2.m_upperIndices.erase(line2.m_upperIndices.findAddr(0));
-				else
-					line2.m_lowerIndices.erase(line2.m_lowerIndices.findAddr(3));
-			}
+			if (mergeUpperVertices)
+				next.m_skipUpperStart = true;
+			else
+				next.m_skipLowerStart = true;
 
-			const int vLowIndex = line1.m_vertices.m_size;
+			const int vLowIndex = prev.m_vertexCount;
 			Vertex	  vLow;
 			vLow.col = opts.color.start;
-			vLow.pos = line2.m_vertices[intersection3].pos;
-			line1.m_vertices.push_back(vLow);
+			vLow.pos = l2[intersection3].pos;
+			buf->PushVertex(vLow);
 
-			const float increase	  = Math::Remap(opts.rounding, 0.0f, 1.0f, 45.0f, 6.0f);
-			const int	parabolaStart = line1.m_vertices.m_size;
-
-			Array<int> lowerIndicesToAdd;
-			Array<int> upperIndicesToAdd;
+			const float increase	  = Config.flatnessTolerance > 0.0f ? Math::Clamp(Math::GetFlatnessAngle(arcRad, Config.flatnessTolerance), 2.0f, 45.0f) : Math::Remap(opts.rounding, 0.0f, 1.0f, 45.0f, 6.0f);
+			const int	parabolaStart = vLowIndex + 1;
 
+			ArcStepper arc(intersectionCenter, arcRad, startAngle + increase, increase);
 			for (float k = startAngle + increase; k < endAngle; k += increase)
 			{
-				const Vec2 p = Math::GetPointOnCircle(intersectionCenter, arcRad, k);
-				Vertex	   v;
+				Vertex v;
 				v.col = opts.color.start;
-				v.pos = p;
-
-				if (addUpperLowerIndices)
-				{
-					if (mergeUpperVertices)
-						lowerIndicesToAdd.push_back(line1.m_vertices.m_size);
-					else
-						upperIndicesToAdd.push_back(line1.m_vertices.m_size);
-				}
-
-				line1.m_vertices.push_back(v);
+				v.pos = arc.Next();
+				buf->PushVertex(v);
 			}
 
+			prev.m_vertexCount	  = buf->vertexBuffer.m_size - prev.m_base;
+			const int parabolaEnd = prev.m_vertexCount - 1;
+
+			// Arc vertices go along the side opposite to the merged one, ordered from start to end.
 			if (addUpperLowerIndices)
 			{
-				if (mergeUpperVertices)
+				Array<int>& indices = mergeUpperVertices ? stroke.lowerIndices : stroke.upperIndices;
+
+				if (ang1 > ang2)
 				{
-					if (ang1 > ang2)
-					{
-						for (int i = 0; i < lowerIndicesToAdd.m_size; i++)
-							line1.m_lowerIndices.push_back(lowerIndicesToAdd[i]);
-					}
-					else
-					{
-						for (int i = lowerIndicesToAdd.m_size - 1; i > -1; i--)
-							line1.m_lowerIndices.push_back(lowerIndicesToAdd[i]);
-					}
+					for (int i = parabolaStart; i <= parabolaEnd; i++)
+						indices.push_back(prev.m_base + i);
 				}
 				else
 				{
-					if (ang1 > ang2)
-					{
-						for (int i = 0; i < upperIndicesToAdd.m_size; i++)
-							line1.m_upperIndices.push_back(upperIndicesToAdd[i]);
-					}
-					else
-					{
-						for (int i = upperIndicesToAdd.m_size - 1; i > -1; i--)
-							line1.m_upperIndices.push_back(upperIndicesToAdd[i]);
-					}
+					for (int i = parabolaEnd; i >= parabolaStart; i--)
+						indices.push_back(prev.m_base + i);
 				}
 			}
 
-			LineTriangle tri1, tri2;
-			tri1.m_indices[0] = intersection1;
-			tri1.m_indices[1] = intersection2;
-			tri1.m_indices[2] = ang1 > ang2 ? parabolaStart : line1.m_vertices.m_size - 1;
-			tri2.m_indices[0] = intersection1;
-			tri2.m_indices[1] = vLowIndex;
-			tri2.m_indices[2] = ang1 > ang2 ? line1.m_vertices.m_size - 1 : parabolaStart;
-			line1.m_tris.push_back(tri1);
-			line1.m_tris.push_back(tri2);
+			PushTriangle(buf, prev.m_base, intersection1, intersection2, ang1 > ang2 ? parabolaStart : parabolaEnd);
+			PushTriangle(buf, prev.m_base, intersection1, vLowIndex, ang1 > ang2 ? parabolaEnd : parabolaStart);
 
-			for (int i = parabolaStart; i < line1.m_vertices.m_size - 1; i++)
-			{
-				LineTriangle tri;
-				tri.m_indices[0] = intersection1;
-				tri.m_indices[1] = i;
-				tri.m_indices[2] = i + 1;
-				line1.m_tris.push_back(tri);
-			}
+			for (int i = parabolaStart; i < parabolaEnd; i++)
+				PushTriangle(buf, prev.m_base, intersection1, i, i + 1);
 		}
 	}
 
 	void Drawer::DrawSimpleLine(SimpleLine& line, StyleOptions& opts, float rotateAngle, int drawOrder)
 	{
-		m_bufferStore.GetData().m_rectOverrideData.m_p1					 = line.m_points[0];
-		m_bufferStore.GetData().m_rectOverrideData.m_p4					 = line.m_points[3];
-		m_bufferStore.GetData().m_rectOverrideData.m_p2					 = line.m_points[1];
-		m_bufferStore.GetData().m_rectOverrideData.m_p3					 = line.m_points[2];
-		m_bufferStore.GetData().m_rectOverrideData.overrideRectPositions = true;
-		DrawRect(m_bufferStore.GetData().m_rectOverrideData.m_p1, m_bufferStore.GetData().m_rectOverrideData.m_p3, opts, rotateAngle, drawOrder);
-		m_bufferStore.GetData().m_rectOverrideData.overrideRectPositions = false;
-	}
-
-	void Drawer::CalculateLineUVs(Line& line)
-	{
-		Vec2 bbMin, bbMax;
-		GetConvexBoundingBox(&line.m_vertices[0], line.m_vertices.m_size, bbMin, bbMax);
-
-		// Recalculate UVs.
-		for (int i = 0; i < line.m_vertices.m_size; i++)
-		{
-			line.m_vertices[i].uv.x = Math::Remap(line.m_vertices[i].pos.x, bbMin.x, bbMax.x, 0.0f, 1.0f);
-			line.m_vertices[i].uv.y = Math::Remap(line.m_vertices[i].pos.y, bbMin.y, bbMax.y, 0.0f, 1.0f);
-		}
+		GetRecordData().m_rectOverrideData.m_p1					 = line.m_points[0];
+		GetRecordData().m_rectOverrideData.m_p4					 = line.m_points[3];
+		GetRecordData().m_rectOverrideData.m_p2					 = line.m_points[1];
+		GetRecordData().m_rectOverrideData.m_p3					 = line.m_points[2];
+		GetRecordData().m_rectOverrideData.overrideRectPositions = true;
+		DrawRect(GetRecordData().m_rectOverrideData.m_p1, GetRecordData().m_rectOverrideData.m_p3, opts, rotateAngle, drawOrder);
+		GetRecordData().m_rectOverrideData.overrideRectPositions = false;
 	}
 
 	DrawBuffer* Drawer::DrawOutlineAroundShape(DrawBuffer* sourceBuffer, StyleOptions& opts, int* indicesOrder, int vertexCount, float defThickness, bool ccw, int drawOrder, OutlineCallType outlineType)
@@ -1737,15 +2844,31 @@ namespace LinaVG
 		float	   thickness   = outlineType != OutlineCallType::Normal ? opts.aaMultiplier * Config.globalAAMultiplier : (defThickness);
 		const bool isAAOutline = outlineType != OutlineCallType::Normal;
 
+#ifdef LINAVG_VERTEX_EDGE_AA
+		// Indices go along one side and back along the other, see DrawOutline.
+		if (isAAOutline)
+		{
+			for (int i = 0; i < vertexCount; i++)
+				sourceBuffer->vertexBuffer[indicesOrder[i]].edge = i < vertexCount / 2 ? 1.0f : -1.0f;
+
+			return sourceBuffer;
+		}
+#endif
+
 		// Determine which buffer to use.
 		// Also correct the buffer pointer if getting a new buffer invalidated it.
 		DrawBuffer* destBuf = nullptr;
 
-		const int sourceIndex = m_bufferStore.GetData().GetBufferIndexInDefaultArray(sourceBuffer);
-		destBuf				  = &m_bufferStore.GetData().GetDefaultBuffer(opts.userData, opts.uniqueID, drawOrder, isAAOutline ? DrawBufferShapeType::AA : DrawBufferShapeType::Shape, outlineType == OutlineCallType::AA ? opts.textureHandle : opts.outlineOptions.textureHandle, outlineType == OutlineCallType::AA ? opts.textureTilingAndOffset : opts.outlineOptions.textureTilingAndOffset);
+		if (isAAOutline && Config.aaInFillBufferEnabled && sourceBuffer->CanFitVertices(vertexCount * 2))
+			destBuf = sourceBuffer;
+		else
+		{
+			const int sourceIndex = GetRecordData().GetBufferIndexInDefaultArray(sourceBuffer);
+			destBuf				  = &GetRecordData().GetDefaultBuffer(opts.userData, opts.uniqueID, drawOrder, isAAOutline ? DrawBufferShapeType::AA : DrawBufferShapeType::Shape, outlineType == OutlineCallType::AA ? opts.textureHandle : opts.outlineOptions.textureHandle, outlineType == OutlineCallType::AA ? opts.textureTilingAndOffset : opts.outlineOptions.textureTilingAndOffset, vertexCount * 2);
 
-		if (sourceIndex != -1)
-			sourceBuffer = &m_bufferStore.GetData().m_defaultBuffers[sourceIndex];
+			if (sourceIndex != -1)
+				sourceBuffer = &GetRecordData().m_defaultBuffers[sourceIndex];
+		}
 
 		// only used if we are drawing AA.
 		Array<int> copiedVerticesOrder;
@@ -1755,7 +2878,7 @@ namespace LinaVG
 		for (int i = 0; i < vertexCount; i++)
 		{
 			Vertex v;
-			v.col = isAAOutline ? sourceBuffer->vertexBuffer[indicesOrder[i]].col : opts.outlineOptions.color.start;
+			v.col = isAAOutline ? static_cast<Vec4>(sourceBuffer->vertexBuffer[indicesOrder[i]].col) : opts.outlineOptions.color.start;
 			v.pos = sourceBuffer->vertexBuffer[indicesOrder[i]].pos;
 			v.uv  = sourceBuffer->vertexBuffer[indicesOrder[i]].uv;
 
@@ -1781,10 +2904,7 @@ namespace LinaVG
 			const int current = destBufStart + i;
 			Vertex	  v;
 			v.uv  = destBuf->vertexBuffer[current].uv;
-			v.col = isAAOutline ? sourceBuffer->vertexBuffer[indicesOrder[i]].col : opts.outlineOptions.color.end;
-
-			if (isAAOutline)
-				v.col.w = 0.0f;
+			v.col = isAAOutline ? WithAlpha(sourceBuffer->vertexBuffer[indicesOrder[i]].col, 0.0f) : opts.outlineOptions.color.end;
 
 			const Vec2 prevP = destBuf->vertexBuffer[prev].pos;
 			const Vec2 nextP = destBuf->vertexBuffer[next].pos;
@@ -1816,12 +2936,20 @@ namespace LinaVG
 			destBuf->PushIndex(current + vertexCount);
 		}
 
+#ifdef LINAVG_VERTEX_EDGE_AA
+		if (opts.aaEnabled && !isAAOutline)
+		{
+			SetVertexEdges(destBuf, destBufStart, destBufStart + vertexCount - 1, 1.0f);
+			SetVertexEdges(destBuf, destBufStart + vertexCount, destBufStart + vertexCount * 2 - 1, -1.0f);
+		}
+#else
 		if (opts.aaEnabled && !isAAOutline)
 		{
 			StyleOptions opts2 = StyleOptions(opts);
 			destBuf			   = DrawOutlineAroundShape(destBuf, opts2, &extrudedVerticesOrder[0], extrudedVerticesOrder.m_size, defThickness, ccw, drawOrder, OutlineCallType::OutlineAA);
 			DrawOutlineAroundShape(destBuf, opts2, &copiedVerticesOrder[0], copiedVerticesOrder.m_size, -defThickness, !ccw, drawOrder, OutlineCallType::OutlineAA);
 		}
+#endif
 
 		return sourceBuffer;
 	}
@@ -1834,16 +2962,6 @@ namespace LinaVG
 		if (reverseDrawDir)
 			thickness = -thickness;
 
-		// Determine which buffer to use.
-		// Also correct the buffer pointer if getting a new buffer invalidated it.
-		DrawBuffer* destBuf = nullptr;
-
-		const int sourceIndex = m_bufferStore.GetData().GetBufferIndexInDefaultArray(sourceBuffer);
-		destBuf				  = &m_bufferStore.GetData().GetDefaultBuffer(opts.userData, opts.uniqueID, drawOrder, isAAOutline ? DrawBufferShapeType::AA : DrawBufferShapeType::Shape, opts.outlineOptions.textureHandle, opts.outlineOptions.textureTilingAndOffset);
-
-		if (sourceIndex != -1)
-			sourceBuffer = &m_bufferStore.GetData().m_defaultBuffers[sourceIndex];
-
 		int startIndex, endIndex;
 
 		if (opts.isFilled)
@@ -1871,11 +2989,53 @@ namespace LinaVG
 			}
 		}
 
+#ifdef LINAVG_VERTEX_EDGE_AA
+		// Mark the source edges instead of extruding a fringe, ring halves get opposite signs so the edge distance falls off towards both.
+		if (isAAOutline)
+		{
+			if (opts.isFilled || opts.outlineOptions.drawDirection == OutlineDrawDirection::Inwards)
+				SetVertexEdges(sourceBuffer, startIndex, endIndex, 1.0f);
+			else if (opts.outlineOptions.drawDirection == OutlineDrawDirection::Outwards)
+				SetVertexEdges(sourceBuffer, startIndex, endIndex, -1.0f);
+			else
+			{
+				SetVertexEdges(sourceBuffer, startIndex, startIndex + vertexCount / 2 - 1, 1.0f);
+				SetVertexEdges(sourceBuffer, startIndex + vertexCount / 2, endIndex, -1.0f);
+			}
+
+			return sourceBuffer;
+		}
+#endif
+
+		// Determine which buffer to use.
+		// Also correct the buffer pointer if getting a new buffer invalidated it.
+		DrawBuffer* destBuf = nullptr;
+
+		if (isAAOutline && Config.aaInFillBufferEnabled && sourceBuffer->CanFitVertices(vertexCount * 2))
+			destBuf = sourceBuffer;
+		else
+		{
+			const int sourceIndex = GetRecordData().GetBufferIndexInDefaultArray(sourceBuffer);
+			destBuf				  = &GetRecordData().GetDefaultBuffer(opts.userData, opts.uniqueID, drawOrder, isAAOutline ? DrawBufferShapeType::AA : DrawBufferShapeType::Shape, opts.outlineOptions.textureHandle, opts.outlineOptions.textureTilingAndOffset, vertexCount * 2);
+
+			if (sourceIndex != -1)
+				sourceBuffer = &GetRecordData().m_defaultBuffers[sourceIndex];
+		}
+
 		Vec2 bbMin, bbMax;
 		GetConvexBoundingBox(sourceBuffer, startIndex, endIndex, bbMin, bbMax);
 		// const bool reCalcUVs	= useTextureBuffer || useGradBuffer;
 		// const int  destBufStart = destBuf->m_vertexBuffer.m_size;
 
+		const bool useAA = opts.aaEnabled && !isAAOutline;
+
+#ifdef LINAVG_VERTEX_EDGE_AA
+		// Rings mark their own edges in copyAndFill.
+		const bool useRingAA = false;
+#else
+		const bool useRingAA = useAA;
+#endif
+
 		auto copyAndFill = [&](DrawBuffer* sourceBuffer, DrawBuffer* destBuf, int startIndex, int endIndex, float thickness) {
 			const int destBufStart = destBuf->vertexBuffer.m_size;
 			const int totalSize	   = endIndex - startIndex + 1;
@@ -1898,9 +3058,8 @@ namespace LinaVG
 				const int previous = i == startIndex ? endIndex : i - 1;
 				const int next	   = i == endIndex ? startIndex : i + 1;
 				Vertex	  v;
-				v.uv	= sourceBuffer->vertexBuffer[i].uv;
-				v.col	= sourceBuffer->vertexBuffer[i].col;
-				v.col.w = 0.0f; // Color will be recalculated if not AA outline.
+				v.uv  = sourceBuffer->vertexBuffer[i].uv;
+				v.col = WithAlpha(sourceBuffer->vertexBuffer[i].col, 0.0f); // Color will be recalculated if not AA outline.
 
 				if (skipEnds && i == startIndex)
 				{
@@ -1922,10 +3081,18 @@ namespace LinaVG
 			}
 
 			Vec2 bbMin, bbMax;
-			New_GetConvexBB(destBuf, destBufStart, destBuf->vertexBuffer.m_size, bbMin, bbMax);
+			Utility::GetVerticesBoundingBox(destBuf->vertexBuffer.m_data + destBufStart, destBuf->vertexBuffer.m_size - destBufStart, bbMin, bbMax);
 
 			if (!isAAOutline)
-				New_CalculateVertexUVsAndColor(destBuf, destBufStart, destBuf->vertexBuffer.m_size, bbMin, bbMax, opts.outlineOptions.color);
+				Utility::CalculateVertexUVsAndColors(destBuf->vertexBuffer.m_data + destBufStart, destBuf->vertexBuffer.m_size - destBufStart, bbMin, bbMax, opts.outlineOptions.color, false);
+
+#ifdef LINAVG_VERTEX_EDGE_AA
+			if (useAA)
+			{
+				SetVertexEdges(destBuf, destBufStart, destBufStart + totalSize - 1, 1.0f);
+				SetVertexEdges(destBuf, destBufStart + totalSize, destBufStart + totalSize * 2 - 1, -1.0f);
+			}
+#endif
 
 			for (int i = destBufStart; i < destBufStart + totalSize; i++)
 			{
@@ -1945,15 +3112,13 @@ namespace LinaVG
 			}
 		};
 
-		const bool useAA = opts.aaEnabled && !isAAOutline;
-
 		if (opts.isFilled)
 		{
 			if (opts.outlineOptions.drawDirection == OutlineDrawDirection::Outwards || opts.outlineOptions.drawDirection == OutlineDrawDirection::Both)
 			{
 				copyAndFill(sourceBuffer, destBuf, startIndex, endIndex, thickness);
 
-				if (useAA)
+				if (useRingAA)
 				{
 					StyleOptions opts2				   = StyleOptions(opts);
 					opts2.isFilled					   = false;
@@ -1968,7 +3133,7 @@ namespace LinaVG
 			{
 				copyAndFill(sourceBuffer, destBuf, startIndex, endIndex, -thickness);
 
-				if (useAA)
+				if (useRingAA)
 				{
 					// AA outline to the current outline we are drawing
 					StyleOptions opts2				   = StyleOptions(opts);
@@ -1995,7 +3160,7 @@ namespace LinaVG
 
 				copyAndFill(sourceBuffer, destBuf, startIndex, endIndex, thickness);
 
-				if (useAA)
+				if (useRingAA)
 				{
 					// AA outline to the current outline we are drawing
 					StyleOptions opts2				   = StyleOptions(opts);
@@ -2018,7 +3183,7 @@ namespace LinaVG
 
 				copyAndFill(sourceBuffer, destBuf, startIndex, endIndex, -thickness);
 
-				if (useAA)
+				if (useRingAA)
 				{
 					// AA outline to the current outline we are drawing
 					StyleOptions opts2				   = StyleOptions(opts);
@@ -2033,7 +3198,7 @@ namespace LinaVG
 			{
 				copyAndFill(sourceBuffer, destBuf, startIndex, startIndex + vertexCount / 2 - 1, -thickness);
 
-				if (useAA)
+				if (useRingAA)
 				{
 					// AA outline to the current outline we are drawing
 					StyleOptions opts2				   = StyleOptions(opts);
@@ -2046,7 +3211,7 @@ namespace LinaVG
 
 				copyAndFill(sourceBuffer, destBuf, startIndex + vertexCount / 2, endIndex, thickness);
 
-				if (useAA)
+				if (useRingAA)
 				{
 					// AA outline to the current outline we are drawing
 					StyleOptions opts2				   = StyleOptions(opts);
@@ -2062,6 +3227,14 @@ namespace LinaVG
 		return sourceBuffer;
 	}
 
+#ifdef LINAVG_VERTEX_EDGE_AA
+	void Drawer::SetVertexEdges(DrawBuffer* buf, int startIndex, int endIndex, float edge)
+	{
+		for (int i = startIndex; i < endIndex + 1; i++)
+			buf->vertexBuffer[i].edge = edge;
+	}
+#endif
+
 #ifndef LINAVG_DISABLE_TEXT_SUPPORT
 
 	void Drawer::ParseTextIntoWords(Array<TextPart*>& arr, const char* text, Font* font, float scale, float spacing)
@@ -2088,7 +3261,7 @@ namespace LinaVG
 			}
 			else
 			{
-				auto& ch = font->glyphs[x];
+				auto& ch = font->GetGlyph(x);
 				size.y	 = Math::Max(size.y, (ch.m_size.y) * scale);
 				size.x += ch.m_advance.x * scale + spacing;
 				word  = word + x;
@@ -2248,7 +3421,7 @@ namespace LinaVG
 
 			for (auto cp : codepoints)
 			{
-				auto ch = opts.font->glyphs[cp];
+				auto ch = opts.font->GetGlyph(cp);
 				process(ch, cp);
 			}
 		}
@@ -2257,7 +3430,7 @@ namespace LinaVG
 			for (c = (uint8_t*)text; *c; c++)
 			{
 				auto character = *c;
-				auto ch		   = opts.font->glyphs[character];
+				auto ch		   = opts.font->GetGlyph(character);
 				process(ch, character);
 			}
 		}
@@ -2384,7 +3557,7 @@ namespace LinaVG
 		// As well as line breaks based on wrapping.
 		for (c = (const uint8_t*)text; *c; c++)
 		{
-			auto& ch = font->glyphs[*c];
+			auto& ch = font->GetGlyph(*c);
 			// float x	 = ch.m_advance.x * scale;
 			// float y	 = ch.m_size.y * scale;
 
@@ -2418,10 +3591,13 @@ namespace LinaVG
 			unsigned long kerning = 0;
 			if (opts.font->supportsKerning && previousCharacter != 0)
 			{
-				auto& table = opts.font->kerningTable[previousCharacter];
-				auto  it	= table.xAdvances.find(c);
-				if (it != table.xAdvances.end())
-					kerning = it->second / 64;
+				auto table = opts.font->kerningTable.find(previousCharacter);
+				if (table != opts.font->kerningTable.end())
+				{
+					auto it = table->second.xAdvances.find(c);
+					if (it != table->second.xAdvances.end())
+						kerning = it->second / 64;
+				}
 			}
 
 			previousCharacter = c;
@@ -2517,7 +3693,7 @@ namespace LinaVG
 
 			for (auto cp : codepoints)
 			{
-				auto ch = opts.font->glyphs[cp];
+				auto ch = opts.font->GetGlyph(cp);
 				drawChar(ch, cp);
 			}
 		}
@@ -2526,7 +3702,7 @@ namespace LinaVG
 			for (c = (uint8_t*)text; *c; c++)
 			{
 				auto character = *c;
-				auto ch		   = opts.font->glyphs[character];
+				auto ch		   = opts.font->GetGlyph(character);
 				drawChar(ch, character);
 			}
 		}
@@ -2601,7 +3777,7 @@ namespace LinaVG
 
 			for (auto cp : codepoints)
 			{
-				auto ch = opts.font->glyphs[cp];
+				auto ch = opts.font->GetGlyph(cp);
 				calcSizeChar(ch, cp);
 			}
 		}
@@ -2610,7 +3786,7 @@ namespace LinaVG
 			for (c = (uint8_t*)text; *c; c++)
 			{
 				auto character = *c;
-				auto ch		   = opts.font->glyphs[character];
+				auto ch		   = opts.font->GetGlyph(character);
 				calcSizeChar(ch, character);
 			}
 		}
@@ -126,6 +126,15 @@ namespace LinaVG
 		return Vec2(x, y);
 	}
 
+	float Math::GetFlatnessAngle(float radius, float tolerance)
+	{
+		if (radius <= tolerance)
+			return 180.0f;
+
+		// Sagitta of the chord, radius * (1 - cos(angle / 2)), equals the tolerance.
+		return 2.0f * std::acos(1.0f - tolerance / radius) / LVG_DEG2RAD;
+	}
+
 	Vec2 Math::SampleParabola(const Vec2& p1, const Vec2& p2, const Vec2& direction, float height, float t)
 	{
 		float parabolicT = t * 2.0f - 1.0f;
@@ -202,8 +211,13 @@ namespace LinaVG
 	Vec2 Math::RotateAround(const Vec2& point, const Vec2& center, float angle)
 	{
 		const float angleRads = LVG_DEG2RAD * angle;
-		float		x		  = std::cos(angleRads) * (point.x - center.x) - std::sin(angleRads) * (point.y - center.y) + center.x;
-		float		y		  = std::sin(angleRads) * (point.x - center.x) + std::cos(angleRads) * (point.y - center.y) + center.y;
+		return RotateAround(point, center, std::cos(angleRads), std::sin(angleRads));
+	}
+
+	Vec2 Math::RotateAround(const Vec2& point, const Vec2& center, float cosAngle, float sinAngle)
+	{
+		float x = cosAngle * (point.x - center.x) - sinAngle * (point.y - center.y) + center.x;
+		float y = sinAngle * (point.x - center.x) + cosAngle * (point.y - center.y) + center.y;
 		return Vec2(x, y);
 	}
 
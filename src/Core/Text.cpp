@@ -74,12 +74,26 @@ namespace LinaVG
 		assert(atlas == nullptr);
 	}
 
-	Atlas::Atlas(const Vec2ui& size, std::function<void(Atlas* atlas)> updateFunc)
+	const TextCharacter& Font::GetGlyph(GlyphEncoding c) const
 	{
+		static const TextCharacter empty;
+
+		auto it = glyphs.find(c);
+		if (it == glyphs.end())
+			return empty;
+
+		return it->second;
+	}
+
+	Atlas::Atlas(const Vec2ui& size, std::function<void(Atlas* atlas)> updateFunc, Allocator* allocator)
+	{
+		const size_t dataSize = static_cast<size_t>(size.x) * size.y;
+
 		m_updateFunc = updateFunc;
 		m_size		 = size;
-		m_data		 = new uint8_t[size.x * size.y];
-		memset(m_data, 0, size.x * size.y);
+		m_allocator	 = allocator;
+		m_data		 = static_cast<uint8_t*>(allocator != nullptr ? allocator->Allocate(dataSize) : LINAVG_MALLOC(dataSize));
+		memset(m_data, 0, dataSize);
 		m_availableSlices.push_back(new Slice(0, size.y));
 	}
 
@@ -91,7 +105,12 @@ namespace LinaVG
 	void Atlas::Destroy()
 	{
 		if (m_data != nullptr)
-			delete[] m_data;
+		{
+			if (m_allocator != nullptr)
+				m_allocator->Free(m_data, static_cast<size_t>(m_size.x) * m_size.y);
+			else
+				LINAVG_FREE(m_data);
+		}
 		m_data = nullptr;
 
 		for (Slice* slice : m_availableSlices)
@@ -396,7 +415,7 @@ namespace LinaVG
 
 		if (foundAtlas == nullptr)
 		{
-			Atlas* newAtlas = new Atlas(Vec2ui(Config.maxFontAtlasSize, Config.maxFontAtlasSize), m_callbacks.atlasNeedsUpdate);
+			Atlas* newAtlas = new Atlas(Vec2ui(Config.maxFontAtlasSize, Config.maxFontAtlasSize), m_callbacks.atlasNeedsUpdate, m_allocator);
 
 			if (!newAtlas->AddFont(font))
 			{
@@ -409,6 +428,19 @@ namespace LinaVG
 		}
 	}
 
+	LINAVG_API void Text::SetAllocator(Allocator* allocator)
+	{
+		if (allocator != nullptr && allocator->IsFrameScoped())
+		{
+			if (Config.errorCallback)
+				Config.errorCallback("LinaVG: Font atlases outlive frames, can't use a frame scoped allocator for them!");
+
+			return;
+		}
+
+		m_allocator = allocator;
+	}
+
 	LINAVG_API void Text::RemoveFontFromAtlas(Font* font)
 	{
 		if (font->atlas)
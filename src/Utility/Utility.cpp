@@ -33,6 +33,13 @@ OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include "LinaVG/Utility/Utility.hpp"
+#include "LinaVG/Core/Math.hpp"
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define LINAVG_UTILITY_SSE2
+#endif
 
 namespace LinaVG
 {
@@ -55,5 +62,152 @@ namespace LinaVG
 			rgbColor.w = 1.0f;
 			return rgbColor;
 		}
+
+		void RadixSort(Array<uint64_t>& keys, Array<uint64_t>& scratch)
+		{
+			const int size = keys.m_size;
+
+			if (size < 2)
+				return;
+
+			scratch.resize(size);
+
+			int histograms[8][256];
+			LINAVG_MEMSET(histograms, 0, sizeof(histograms));
+
+			for (int i = 0; i < size; i++)
+			{
+				const uint64_t key = keys.m_data[i];
+				for (int pass = 0; pass < 8; pass++)
+					histograms[pass][(key >> (pass * 8)) & 0xFF]++;
+			}
+
+			uint64_t* src = keys.m_data;
+			uint64_t* dst = scratch.m_data;
+
+			for (int pass = 0; pass < 8; pass++)
+			{
+				int*	  histogram = histograms[pass];
+				const int shift		= pass * 8;
+
+				if (histogram[(src[0] >> shift) & 0xFF] == size)
+					continue;
+
+				int offset = 0;
+				for (int i = 0; i < 256; i++)
+				{
+					const int count = histogram[i];
+					histogram[i]	= offset;
+					offset += count;
+				}
+
+				for (int i = 0; i < size; i++)
+					dst[histogram[(src[i] >> shift) & 0xFF]++] = src[i];
+
+				uint64_t* temp = src;
+				src			   = dst;
+				dst			   = temp;
+			}
+
+			if (src != keys.m_data)
+				LINAVG_MEMCPY(keys.m_data, src, static_cast<size_t>(size) * sizeof(uint64_t));
+		}
+
+		void TranslateVertices(Vertex* dst, const Vertex* src, int count, const Vec2& offset)
+		{
+			int i = 0;
+
+#ifdef LINAVG_UTILITY_SSE2
+			// Position & uv in the first 4 floats, color in the next 4.
+			if (sizeof(Vertex) == 8 * sizeof(float) && offsetof(Vertex, pos) == 0)
+			{
+				const __m128 add = _mm_setr_ps(offset.x, offset.y, 0.0f, 0.0f);
+
+				for (; i < count; i++)
+				{
+					const float* s = reinterpret_cast<const float*>(src + i);
+					float*		 d = reinterpret_cast<float*>(dst + i);
+					_mm_storeu_ps(d, _mm_add_ps(_mm_loadu_ps(s), add));
+					_mm_storeu_ps(d + 4, _mm_loadu_ps(s + 4));
+				}
+			}
+#endif
+
+			for (; i < count; i++)
+			{
+				dst[i] = src[i];
+				dst[i].pos.x += offset.x;
+				dst[i].pos.y += offset.y;
+			}
+		}
+
+		void TransformText(Vertex* dst, const Vertex* src, int count, const Vec2& center, const Vec2& offset, float scale, float angle)
+		{
+			if (scale == 1.0f && Math::IsEqualMarg(angle, 0.0f))
+			{
+				TranslateVertices(dst, src, count, offset);
+				return;
+			}
+
+			// Fold everything into pos' = M * pos + t.
+			const float angleRads = LVG_DEG2RAD * angle;
+			const float m00		  = std::cos(angleRads) * scale;
+			const float m10		  = std::sin(angleRads) * scale;
+			const float m01		  = -m10;
+			const float m11		  = m00;
+			const float tx		  = offset.x + center.x * scale - (m00 * center.x + m01 * center.y);
+			const float ty		  = offset.y + center.y * scale - (m10 * center.x + m11 * center.y);
+
+			int i = 0;
+
+#ifdef LINAVG_UTILITY_SSE2
+			if (sizeof(Vertex) == 8 * sizeof(float) && offsetof(Vertex, pos) == 0)
+			{
+				const __m128 colX = _mm_setr_ps(m00, m10, 1.0f, 1.0f);
+				const __m128 colY = _mm_setr_ps(m01, m11, 0.0f, 0.0f);
+				const __m128 add  = _mm_setr_ps(tx, ty, 0.0f, 0.0f);
+
+				for (; i < count; i++)
+				{
+					const float* s	= reinterpret_cast<const float*>(src + i);
+					float*		 d	= reinterpret_cast<float*>(dst + i);
+					const __m128 xy = _mm_loadu_ps(s);
+
+					// (x, x, u, v) * colX + (y, y, y, y) * colY keeps the uvs.
+					const __m128 xs = _mm_shuffle_ps(xy, xy, _MM_SHUFFLE(3, 2, 0, 0));
+					const __m128 ys = _mm_shuffle_ps(xy, xy, _MM_SHUFFLE(1, 1, 1, 1));
+					_mm_storeu_ps(d, _mm_add_ps(_mm_add_ps(_mm_mul_ps(xs, colX), _mm_mul_ps(ys, colY)), add));
+					_mm_storeu_ps(d + 4, _mm_loadu_ps(s + 4));
+				}
+			}
+#endif
+
+			for (; i < count; i++)
+			{
+				const Vec2 p = src[i].pos;
+				dst[i]		 = src[i];
+				dst[i].pos.x = m00 * p.x + m01 * p.y + tx;
+				dst[i].pos.y = m10 * p.x + m11 * p.y + ty;
+			}
+		}
+
+		void RebaseIndices(Index* dst, const Index* src, int count, int baseVertex)
+		{
+			int i = 0;
+
+#ifdef LINAVG_UTILITY_SSE2
+			constexpr int lanes = static_cast<int>(sizeof(__m128i) / sizeof(Index));
+			const __m128i add	= sizeof(Index) == 2 ? _mm_set1_epi16(static_cast<short>(baseVertex)) : _mm_set1_epi32(baseVertex);
+
+			for (; i + lanes <= count; i += lanes)
+			{
+				const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), sizeof(Index) == 2 ? _mm_add_epi16(v, add) : _mm_add_epi32(v, add));
+			}
+#endif
+
+			for (; i < count; i++)
+				dst[i] = static_cast<Index>(src[i] + baseVertex);
+		}
 	} // namespace Utility
 } // namespace LinaVG
@@ -0,0 +1,674 @@
+/*
+This file is a part of: LinaVG
+https://github.com/inanevin/LinaVG
+
+Author: Inan Evin
+http://www.inanevin.com
+
+The 2-Clause BSD License
+
+Copyright (c) [2022-] Inan Evin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+   1. Redistributions of source code must retain the above copyright notice, this
+	  list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright notice,
+	  this list of conditions and the following disclaimer in the documentation
+	  and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "LinaVG/Utility/Utility.hpp"
+#include "LinaVG/Core/Math.hpp"
+#include <cmath>
+#include <cstddef>
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define LINAVG_KERNELS_NEON
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define LINAVG_KERNELS_SSE2
+#if defined(__GNUC__)
+#include <immintrin.h>
+#define LINAVG_KERNELS_AVX2
+#define LINAVG_TARGET_AVX2 __attribute__((target("avx2")))
+#elif defined(_MSC_VER)
+#include <immintrin.h>
+#include <intrin.h>
+#define LINAVG_KERNELS_AVX2
+#define LINAVG_TARGET_AVX2
+#endif
+#endif
+
+namespace LinaVG
+{
+	namespace Utility
+	{
+		namespace
+		{
+			// Vectorized kernels treat vertices as 8 floats, position & uv followed by color.
+			constexpr bool DEFAULT_VERTEX_LAYOUT = sizeof(Vertex) == 8 * sizeof(float) && offsetof(Vertex, pos) == 0 && offsetof(Vertex, uv) == 2 * sizeof(float) && offsetof(Vertex, col) == 4 * sizeof(float);
+
+			// Vertices per block in CalculateVertexUVsAndColors, 16 KB with the default layout.
+			constexpr int KERNEL_BLOCK_SIZE = 512;
+
+			SIMDLevel DetectSIMDLevel()
+			{
+#if defined(LINAVG_KERNELS_NEON)
+				return SIMDLevel::NEON;
+#elif defined(LINAVG_KERNELS_AVX2) && defined(__GNUC__)
+				return __builtin_cpu_supports("avx2") ? SIMDLevel::AVX2 : SIMDLevel::SSE2;
+#elif defined(LINAVG_KERNELS_AVX2)
+				// AVX2 support, along with the OS saving ymm registers.
+				int info[4];
+				__cpuid(info, 1);
+				const bool osAVX = (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0 && (_xgetbv(0) & 6) == 6;
+				__cpuidex(info, 7, 0);
+				return osAVX && (info[1] & (1 << 5)) != 0 ? SIMDLevel::AVX2 : SIMDLevel::SSE2;
+#elif defined(LINAVG_KERNELS_SSE2)
+				return SIMDLevel::SSE2;
+#else
+				return SIMDLevel::Scalar;
+#endif
+			}
+
+			SIMDLevel GetDetectedLevel()
+			{
+				static const SIMDLevel level = DetectSIMDLevel();
+				return level;
+			}
+
+			SIMDLevel& GetActiveLevel()
+			{
+				static SIMDLevel level = GetDetectedLevel();
+				return level;
+			}
+
+			bool IsSIMDLevelSupported(SIMDLevel level)
+			{
+				const SIMDLevel detected = GetDetectedLevel();
+
+				if (level == SIMDLevel::Scalar || level == detected)
+					return true;
+
+				return level == SIMDLevel::SSE2 && detected == SIMDLevel::AVX2;
+			}
+
+			// Scalar kernels, also handling the tails of the vectorized ones.
+			// Operations are in the same order across all kernels, so results don't depend on the level.
+
+			void RotateScalar(Vertex* vertices, int start, int count, const Vec2& center, float c, float s)
+			{
+				for (int i = start; i < count; i++)
+				{
+					const float dx	  = vertices[i].pos.x - center.x;
+					const float dy	  = vertices[i].pos.y - center.y;
+					vertices[i].pos.x = c * dx - s * dy + center.x;
+					vertices[i].pos.y = s * dx + c * dy + center.y;
+				}
+			}
+
+			void BoundingBoxScalar(const Vertex* vertices, int start, int count, Vec2& outMin, Vec2& outMax)
+			{
+				for (int i = start; i < count; i++)
+				{
+					const Vec2& p = vertices[i].pos;
+
+					if (p.x < outMin.x)
+						outMin.x = p.x;
+					if (p.x > outMax.x)
+						outMax.x = p.x;
+					if (p.y < outMin.y)
+						outMin.y = p.y;
+					if (p.y > outMax.y)
+						outMax.y = p.y;
+				}
+			}
+
+			void UVsScalar(Vertex* vertices, int start, int count, const Vec2& bbMin, const Vec2& bbMax)
+			{
+				for (int i = start; i < count; i++)
+				{
+					vertices[i].uv.x = Math::Remap(vertices[i].pos.x, bbMin.x, bbMax.x, 0.0f, 1.0f);
+					vertices[i].uv.y = Math::Remap(vertices[i].pos.y, bbMin.y, bbMax.y, 0.0f, 1.0f);
+				}
+			}
+
+			void ColorsScalar(Vertex* vertices, int start, int count, const Vec4Grad& color, bool preserveAlpha)
+			{
+				for (int i = start; i < count; i++)
+				{
+					Vertex&	   vertex	   = vertices[i];
+					const Vec4 previousCol = vertex.col;
+					Vec4	   col		   = color.start;
+
+					if (color.gradientType == GradientType::Horizontal)
+						col = Math::Lerp(color.start, color.end, static_cast<float>(vertex.uv.x));
+					else if (color.gradientType != GradientType::None)
+						col = Math::Lerp(color.start, color.end, static_cast<float>(vertex.uv.y));
+
+					if (preserveAlpha)
+						col.w = previousCol.w;
+
+					vertex.col = col;
+				}
+			}
+
+#ifdef LINAVG_KERNELS_SSE2
+
+			// Position & uv of 4 vertices as x, y, u & v rows, TransposeSSE2 again to write back.
+			inline void LoadPosUV4SSE2(const float* p, __m128& r0, __m128& r1, __m128& r2, __m128& r3)
+			{
+				r0 = _mm_loadu_ps(p);
+				r1 = _mm_loadu_ps(p + 8);
+				r2 = _mm_loadu_ps(p + 16);
+				r3 = _mm_loadu_ps(p + 24);
+				_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+			}
+
+			inline void StorePosUV4SSE2(float* p, __m128 r0, __m128 r1, __m128 r2, __m128 r3)
+			{
+				_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+				_mm_storeu_ps(p, r0);
+				_mm_storeu_ps(p + 8, r1);
+				_mm_storeu_ps(p + 16, r2);
+				_mm_storeu_ps(p + 24, r3);
+			}
+
+			int RotateSSE2(Vertex* vertices, int count, const Vec2& center, float c, float s)
+			{
+				const __m128 cx	  = _mm_set1_ps(center.x);
+				const __m128 cy	  = _mm_set1_ps(center.y);
+				const __m128 cosv = _mm_set1_ps(c);
+				const __m128 sinv = _mm_set1_ps(s);
+
+				int i = 0;
+				for (; i + 4 <= count; i += 4)
+				{
+					float* p = reinterpret_cast<float*>(vertices + i);
+					__m128 x, y, u, v;
+					LoadPosUV4SSE2(p, x, y, u, v);
+
+					const __m128 dx = _mm_sub_ps(x, cx);
+					const __m128 dy = _mm_sub_ps(y, cy);
+					x				= _mm_add_ps(_mm_sub_ps(_mm_mul_ps(cosv, dx), _mm_mul_ps(sinv, dy)), cx);
+					y				= _mm_add_ps(_mm_add_ps(_mm_mul_ps(sinv, dx), _mm_mul_ps(cosv, dy)), cy);
+					StorePosUV4SSE2(p, x, y, u, v);
+				}
+
+				return i;
+			}
+
+			int BoundingBoxSSE2(const Vertex* vertices, int count, Vec2& outMin, Vec2& outMax)
+			{
+				// Only the first two lanes, x & y, are used.
+				__m128 mn = _mm_setr_ps(outMin.x, outMin.y, 0.0f, 0.0f);
+				__m128 mx = _mm_setr_ps(outMax.x, outMax.y, 0.0f, 0.0f);
+
+				for (int i = 0; i < count; i++)
+				{
+					// Operand order keeps the scalar behaviour on ties & NaNs.
+					const __m128 p = _mm_loadu_ps(reinterpret_cast<const float*>(vertices + i));
+					mn			   = _mm_min_ps(p, mn);
+					mx			   = _mm_max_ps(p, mx);
+				}
+
+				float lanes[4];
+				_mm_storeu_ps(lanes, mn);
+				outMin = Vec2(lanes[0], lanes[1]);
+				_mm_storeu_ps(lanes, mx);
+				outMax = Vec2(lanes[0], lanes[1]);
+				return count;
+			}
+
+			int UVsSSE2(Vertex* vertices, int count, const Vec2& bbMin, const Vec2& bbMax)
+			{
+				const __m128 zero  = _mm_setzero_ps();
+				const __m128 minX  = _mm_set1_ps(bbMin.x);
+				const __m128 minY  = _mm_set1_ps(bbMin.y);
+				const __m128 sizeX = _mm_set1_ps(bbMax.x - bbMin.x);
+				const __m128 sizeY = _mm_set1_ps(bbMax.y - bbMin.y);
+
+				int i = 0;
+				for (; i + 4 <= count; i += 4)
+				{
+					float* p = reinterpret_cast<float*>(vertices + i);
+					__m128 x, y, u, v;
+					LoadPosUV4SSE2(p, x, y, u, v);
+					u = _mm_add_ps(zero, _mm_div_ps(_mm_sub_ps(x, minX), sizeX));
+					v = _mm_add_ps(zero, _mm_div_ps(_mm_sub_ps(y, minY), sizeY));
+					StorePosUV4SSE2(p, x, y, u, v);
+				}
+
+				return i;
+			}
+
+			int ColorsSSE2(Vertex* vertices, int count, const Vec4Grad& color, bool preserveAlpha)
+			{
+				const __m128 start = _mm_setr_ps(color.start.x, color.start.y, color.start.z, color.start.w);
+				const __m128 end   = _mm_setr_ps(color.end.x, color.end.y, color.end.z, color.end.w);
+				const __m128 one   = _mm_set1_ps(1.0f);
+				const __m128 rgb   = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+				const int	 uvIdx = color.gradientType == GradientType::Horizontal ? 2 : 3;
+
+				for (int i = 0; i < count; i++)
+				{
+					float* p   = reinterpret_cast<float*>(vertices + i);
+					__m128 col = start;
+
+					if (color.gradientType != GradientType::None)
+					{
+						const __m128 amt = _mm_set1_ps(p[uvIdx]);
+						col				 = _mm_add_ps(_mm_mul_ps(start, _mm_sub_ps(one, amt)), _mm_mul_ps(end, amt));
+					}
+
+					if (preserveAlpha)
+						col = _mm_or_ps(_mm_and_ps(rgb, col), _mm_andnot_ps(rgb, _mm_loadu_ps(p + 4)));
+
+					_mm_storeu_ps(p + 4, col);
+				}
+
+				return count;
+			}
+
+#endif
+
+#ifdef LINAVG_KERNELS_AVX2
+
+			// 4x4 transpose within each 128 bit lane, see _MM_TRANSPOSE4_PS.
+			LINAVG_TARGET_AVX2 inline void Transpose4AVX2(__m256& r0, __m256& r1, __m256& r2, __m256& r3)
+			{
+				const __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+				const __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+				const __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+				const __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+				r0				= _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+				r1				= _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+				r2				= _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+				r3				= _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+			}
+
+			// Position & uv of 8 vertices as x, y, u & v rows, vertex i in the low lane & i + 4 in the high one.
+			LINAVG_TARGET_AVX2 inline void LoadPosUV8AVX2(const float* p, __m256& r0, __m256& r1, __m256& r2, __m256& r3)
+			{
+				r0 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p)), _mm_loadu_ps(p + 32), 1);
+				r1 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 8)), _mm_loadu_ps(p + 40), 1);
+				r2 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 16)), _mm_loadu_ps(p + 48), 1);
+				r3 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 24)), _mm_loadu_ps(p + 56), 1);
+				Transpose4AVX2(r0, r1, r2, r3);
+			}
+
+			LINAVG_TARGET_AVX2 inline void StorePosUV8AVX2(float* p, __m256 r0, __m256 r1, __m256 r2, __m256 r3)
+			{
+				Transpose4AVX2(r0, r1, r2, r3);
+				_mm_storeu_ps(p, _mm256_castps256_ps128(r0));
+				_mm_storeu_ps(p + 8, _mm256_castps256_ps128(r1));
+				_mm_storeu_ps(p + 16, _mm256_castps256_ps128(r2));
+				_mm_storeu_ps(p + 24, _mm256_castps256_ps128(r3));
+				_mm_storeu_ps(p + 32, _mm256_extractf128_ps(r0, 1));
+				_mm_storeu_ps(p + 40, _mm256_extractf128_ps(r1, 1));
+				_mm_storeu_ps(p + 48, _mm256_extractf128_ps(r2, 1));
+				_mm_storeu_ps(p + 56, _mm256_extractf128_ps(r3, 1));
+			}
+
+			LINAVG_TARGET_AVX2 int RotateAVX2(Vertex* vertices, int count, const Vec2& center, float c, float s)
+			{
+				const __m256 cx	  = _mm256_set1_ps(center.x);
+				const __m256 cy	  = _mm256_set1_ps(center.y);
+				const __m256 cosv = _mm256_set1_ps(c);
+				const __m256 sinv = _mm256_set1_ps(s);
+
+				int i = 0;
+				for (; i + 8 <= count; i += 8)
+				{
+					float* p = reinterpret_cast<float*>(vertices + i);
+					__m256 x, y, u, v;
+					LoadPosUV8AVX2(p, x, y, u, v);
+
+					const __m256 dx = _mm256_sub_ps(x, cx);
+					const __m256 dy = _mm256_sub_ps(y, cy);
+					x				= _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(cosv, dx), _mm256_mul_ps(sinv, dy)), cx);
+					y				= _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(sinv, dx), _mm256_mul_ps(cosv, dy)), cy);
+					StorePosUV8AVX2(p, x, y, u, v);
+				}
+
+				return i;
+			}
+
+			LINAVG_TARGET_AVX2 int BoundingBoxAVX2(const Vertex* vertices, int count, Vec2& outMin, Vec2& outMax)
+			{
+				// Two vertices per register, only x & y lanes of each half are used.
+				__m256 mn = _mm256_setr_ps(outMin.x, outMin.y, 0.0f, 0.0f, outMin.x, outMin.y, 0.0f, 0.0f);
+				__m256 mx = _mm256_setr_ps(outMax.x, outMax.y, 0.0f, 0.0f, outMax.x, outMax.y, 0.0f, 0.0f);
+
+				int i = 0;
+				for (; i + 2 <= count; i += 2)
+				{
+					const float* p	= reinterpret_cast<const float*>(vertices + i);
+					const __m256 pp = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p)), _mm_loadu_ps(p + 8), 1);
+					mn				= _mm256_min_ps(pp, mn);
+					mx				= _mm256_max_ps(pp, mx);
+				}
+
+				float lanes[8];
+				_mm256_storeu_ps(lanes, mn);
+				outMin = Vec2(Math::Min(lanes[0], lanes[4]), Math::Min(lanes[1], lanes[5]));
+				_mm256_storeu_ps(lanes, mx);
+				outMax = Vec2(Math::Max(lanes[0], lanes[4]), Math::Max(lanes[1], lanes[5]));
+				return i;
+			}
+
+			LINAVG_TARGET_AVX2 int UVsAVX2(Vertex* vertices, int count, const Vec2& bbMin, const Vec2& bbMax)
+			{
+				const __m256 zero  = _mm256_setzero_ps();
+				const __m256 minX  = _mm256_set1_ps(bbMin.x);
+				const __m256 minY  = _mm256_set1_ps(bbMin.y);
+				const __m256 sizeX = _mm256_set1_ps(bbMax.x - bbMin.x);
+				const __m256 sizeY = _mm256_set1_ps(bbMax.y - bbMin.y);
+
+				int i = 0;
+				for (; i + 8 <= count; i += 8)
+				{
+					float* p = reinterpret_cast<float*>(vertices + i);
+					__m256 x, y, u, v;
+					LoadPosUV8AVX2(p, x, y, u, v);
+					u = _mm256_add_ps(zero, _mm256_div_ps(_mm256_sub_ps(x, minX), sizeX));
+					v = _mm256_add_ps(zero, _mm256_div_ps(_mm256_sub_ps(y, minY), sizeY));
+					StorePosUV8AVX2(p, x, y, u, v);
+				}
+
+				return i;
+			}
+
+			LINAVG_TARGET_AVX2 int ColorsAVX2(Vertex* vertices, int count, const Vec4Grad& color, bool preserveAlpha)
+			{
+				// Two vertices per register.
+				const __m256 start = _mm256_setr_ps(color.start.x, color.start.y, color.start.z, color.start.w, color.start.x, color.start.y, color.start.z, color.start.w);
+				const __m256 end   = _mm256_setr_ps(color.end.x, color.end.y, color.end.z, color.end.w, color.end.x, color.end.y, color.end.z, color.end.w);
+				const __m256 one   = _mm256_set1_ps(1.0f);
+				const int	 uvIdx = color.gradientType == GradientType::Horizontal ? 2 : 3;
+
+				int i = 0;
+				for (; i + 2 <= count; i += 2)
+				{
+					float* p   = reinterpret_cast<float*>(vertices + i);
+					__m256 col = start;
+
+					if (color.gradientType != GradientType::None)
+					{
+						const __m256 amt = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_set1_ps(p[uvIdx])), _mm_set1_ps(p[8 + uvIdx]), 1);
+						col				 = _mm256_add_ps(_mm256_mul_ps(start, _mm256_sub_ps(one, amt)), _mm256_mul_ps(end, amt));
+					}
+
+					if (preserveAlpha)
+					{
+						const __m256 previous = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 4)), _mm_loadu_ps(p + 12), 1);
+						col					  = _mm256_blend_ps(col, previous, 0x88);
+					}
+
+					_mm_storeu_ps(p + 4, _mm256_castps256_ps128(col));
+					_mm_storeu_ps(p + 12, _mm256_extractf128_ps(col, 1));
+				}
+
+				return i;
+			}
+
+#endif
+
+#ifdef LINAVG_KERNELS_NEON
+
+			int RotateNEON(Vertex* vertices, int count, const Vec2& center, float c, float s)
+			{
+				// (c * dx, s * dx) + (-s * dy, c * dy)
+				const float		  colXData[2]	= {c, s};
+				const float		  colYData[2]	= {-s, c};
+				const float		  centerData[2] = {center.x, center.y};
+				const float32x2_t colX			= vld1_f32(colXData);
+				const float32x2_t colY			= vld1_f32(colYData);
+				const float32x2_t cxy			= vld1_f32(centerData);
+
+				for (int i = 0; i < count; i++)
+				{
+					float*			  p = reinterpret_cast<float*>(vertices + i);
+					const float32x2_t d = vsub_f32(vld1_f32(p), cxy);
+					const float32x2_t r = vadd_f32(vmul_f32(colX, vdup_lane_f32(d, 0)), vmul_f32(colY, vdup_lane_f32(d, 1)));
+					vst1_f32(p, vadd_f32(r, cxy));
+				}
+
+				return count;
+			}
+
+			int BoundingBoxNEON(const Vertex* vertices, int count, Vec2& outMin, Vec2& outMax)
+			{
+				const float minData[2] = {outMin.x, outMin.y};
+				const float maxData[2] = {outMax.x, outMax.y};
+				float32x2_t mn		   = vld1_f32(minData);
+				float32x2_t mx		   = vld1_f32(maxData);
+
+				for (int i = 0; i < count; i++)
+				{
+					// Selects instead of vmin/vmax to keep the scalar behaviour on NaNs.
+					const float32x2_t p = vld1_f32(reinterpret_cast<const float*>(vertices + i));
+					mn					= vbsl_f32(vclt_f32(p, mn), p, mn);
+					mx					= vbsl_f32(vcgt_f32(p, mx), p, mx);
+				}
+
+				outMin = Vec2(vget_lane_f32(mn, 0), vget_lane_f32(mn, 1));
+				outMax = Vec2(vget_lane_f32(mx, 0), vget_lane_f32(mx, 1));
+				return count;
+			}
+
+			int UVsNEON(Vertex* vertices, int count, const Vec2& bbMin, const Vec2& bbMax)
+			{
+				const float		  minData[2]  = {bbMin.x, bbMin.y};
+				const float		  sizeData[2] = {bbMax.x - bbMin.x, bbMax.y - bbMin.y};
+				const float32x2_t zero		  = vdup_n_f32(0.0f);
+				const float32x2_t mn		  = vld1_f32(minData);
+				const float32x2_t size		  = vld1_f32(sizeData);
+
+				for (int i = 0; i < count; i++)
+				{
+					float* p = reinterpret_cast<float*>(vertices + i);
+					vst1_f32(p + 2, vadd_f32(zero, vdiv_f32(vsub_f32(vld1_f32(p), mn), size)));
+				}
+
+				return count;
+			}
+
+			int ColorsNEON(Vertex* vertices, int count, const Vec4Grad& color, bool preserveAlpha)
+			{
+				const float		  startData[4] = {color.start.x, color.start.y, color.start.z, color.start.w};
+				const float		  endData[4]   = {color.end.x, color.end.y, color.end.z, color.end.w};
+				const float32x4_t start		   = vld1q_f32(startData);
+				const float32x4_t end		   = vld1q_f32(endData);
+				const float32x4_t one		   = vdupq_n_f32(1.0f);
+				const int		  uvIdx		   = color.gradientType == GradientType::Horizontal ? 2 : 3;
+
+				for (int i = 0; i < count; i++)
+				{
+					float*		p	= reinterpret_cast<float*>(vertices + i);
+					float32x4_t col = start;
+
+					if (color.gradientType != GradientType::None)
+					{
+						const float32x4_t amt = vdupq_n_f32(p[uvIdx]);
+						col					  = vaddq_f32(vmulq_f32(start, vsubq_f32(one, amt)), vmulq_f32(end, amt));
+					}
+
+					if (preserveAlpha)
+						col = vsetq_lane_f32(p[7], col, 3);
+
+					vst1q_f32(p + 4, col);
+				}
+
+				return count;
+			}
+
+#endif
+		} // namespace
+
+		SIMDLevel GetSIMDLevel()
+		{
+			return GetActiveLevel();
+		}
+
+		void SetSIMDLevel(SIMDLevel level)
+		{
+			GetActiveLevel() = IsSIMDLevelSupported(level) ? level : GetDetectedLevel();
+		}
+
+		void RotateVertices(Vertex* vertices, int count, const Vec2& center, float angle)
+		{
+			const float angleRads = LVG_DEG2RAD * angle;
+			const float c		  = std::cos(angleRads);
+			const float s		  = std::sin(angleRads);
+			int			i		  = 0;
+
+			if (DEFAULT_VERTEX_LAYOUT)
+			{
+				switch (GetActiveLevel())
+				{
+#ifdef LINAVG_KERNELS_AVX2
+				case SIMDLevel::AVX2:
+					i = RotateAVX2(vertices, count, center, c, s);
+					break;
+#endif
+#ifdef LINAVG_KERNELS_SSE2
+				case SIMDLevel::SSE2:
+					i = RotateSSE2(vertices, count, center, c, s);
+					break;
+#endif
+#ifdef LINAVG_KERNELS_NEON
+				case SIMDLevel::NEON:
+					i = RotateNEON(vertices, count, center, c, s);
+					break;
+#endif
+				default:
+					break;
+				}
+			}
+
+			RotateScalar(vertices, i, count, center, c, s);
+		}
+
+		void GetVerticesBoundingBox(const Vertex* vertices, int count, Vec2& outMin, Vec2& outMax)
+		{
+			outMin = Vec2(99999, 99999);
+			outMax = Vec2(-99999, -99999);
+			int i  = 0;
+
+			if (DEFAULT_VERTEX_LAYOUT)
+			{
+				switch (GetActiveLevel())
+				{
+#ifdef LINAVG_KERNELS_AVX2
+				case SIMDLevel::AVX2:
+					i = BoundingBoxAVX2(vertices, count, outMin, outMax);
+					break;
+#endif
+#ifdef LINAVG_KERNELS_SSE2
+				case SIMDLevel::SSE2:
+					i = BoundingBoxSSE2(vertices, count, outMin, outMax);
+					break;
+#endif
+#ifdef LINAVG_KERNELS_NEON
+				case SIMDLevel::NEON:
+					i = BoundingBoxNEON(vertices, count, outMin, outMax);
+					break;
+#endif
+				default:
+					break;
+				}
+			}
+
+			BoundingBoxScalar(vertices, i, count, outMin, outMax);
+		}
+
+		void CalculateVertexUVs(Vertex* vertices, int count, const Vec2& bbMin, const Vec2& bbMax)
+		{
+			int i = 0;
+
+			if (DEFAULT_VERTEX_LAYOUT)
+			{
+				switch (GetActiveLevel())
+				{
+#ifdef LINAVG_KERNELS_AVX2
+				case SIMDLevel::AVX2:
+					i = UVsAVX2(vertices, count, bbMin, bbMax);
+					break;
+#endif
+#ifdef LINAVG_KERNELS_SSE2
+				case SIMDLevel::SSE2:
+					i = UVsSSE2(vertices, count, bbMin, bbMax);
+					break;
+#endif
+#ifdef LINAVG_KERNELS_NEON
+				case SIMDLevel::NEON:
+					i = UVsNEON(vertices, count, bbMin, bbMax);
+					break;
+#endif
+				default:
+					break;
+				}
+			}
+
+			UVsScalar(vertices, i, count, bbMin, bbMax);
+		}
+
+		void CalculateVertexColors(Vertex* vertices, int count, const Vec4Grad& color, bool preserveAlpha)
+		{
+			int i = 0;
+
+			if (DEFAULT_VERTEX_LAYOUT)
+			{
+				switch (GetActiveLevel())
+				{
+#ifdef LINAVG_KERNELS_AVX2
+				case SIMDLevel::AVX2:
+					i = ColorsAVX2(vertices, count, color, preserveAlpha);
+					break;
+#endif
+#ifdef LINAVG_KERNELS_SSE2
+				case SIMDLevel::SSE2:
+					i = ColorsSSE2(vertices, count, color, preserveAlpha);
+					break;
+#endif
+#ifdef LINAVG_KERNELS_NEON
+				case SIMDLevel::NEON:
+					i = ColorsNEON(vertices, count, color, preserveAlpha);
+					break;
+#endif
+				default:
+					break;
+				}
+			}
+
+			ColorsScalar(vertices, i, count, color, preserveAlpha);
+		}
+
+		void CalculateVertexUVsAndColors(Vertex* vertices, int count, const Vec2& bbMin, const Vec2& bbMax, const Vec4Grad& color, bool preserveAlpha)
+		{
+			for (int i = 0; i < count; i += KERNEL_BLOCK_SIZE)
+			{
+				const int blockSize = Math::Min(KERNEL_BLOCK_SIZE, count - i);
+				CalculateVertexUVs(vertices + i, blockSize, bbMin, bbMax);
+				CalculateVertexColors(vertices + i, blockSize, color, preserveAlpha);
+			}
+		}
+	} // namespace Utility
+} // namespace LinaVG
@@ -0,0 +1,154 @@
+/*
+This file is a part of: LinaVG
+https://github.com/inanevin/LinaVG
+
+Author: Inan Evin
+http://www.inanevin.com
+
+The 2-Clause BSD License
+
+Copyright (c) [2022-] Inan Evin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+   1. Redistributions of source code must retain the above copyright notice, this
+	  list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright notice,
+	  this list of conditions and the following disclaimer in the documentation
+	  and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+// Draws layered frames with batchMergingEnabled on & off, checking merging cuts draw calls without changing the geometry or its order.
+
+#include "LinaVG/LinaVG.hpp"
+#include "TestCommon.hpp"
+#include <cstring>
+#include <vector>
+
+using namespace LinaVG;
+
+namespace
+{
+	constexpr int FRAME_COUNT = 4;
+
+	struct CapturedFrame
+	{
+		std::vector<Vertex> vertices;
+		std::vector<int>	indices;
+		std::vector<int>	arenaIndices;
+		std::vector<float>	instanceCenters;
+		int					draws = 0;
+	};
+
+	// Draw orders used purely for layering, with a texture change in the middle & instanced rects that merge on their own.
+	void DrawFrame(Drawer& drawer, int frame)
+	{
+		StyleOptions style;
+
+		for (int i = 0; i < 40; i++)
+		{
+			style.color			= Vec4(static_cast<float>(i) / 40.0f, 0.5f, 0.2f, 1.0f);
+			style.rounding		= 0.3f;
+			style.textureHandle = (i / 10) == 2 ? reinterpret_cast<TextureHandle>(1) : NULL_TEXTURE;
+			const float x		= static_cast<float>(i * 12 + frame);
+			drawer.DrawRect(Vec2(x, 10.0f), Vec2(x + 30.0f, 50.0f), style, 0.0f, i);
+		}
+
+		Config.instancedShapesEnabled = true;
+		StyleOptions instanced;
+		for (int i = 0; i < 10; i++)
+			drawer.DrawRect(Vec2(static_cast<float>(i * 20), 100.0f), Vec2(static_cast<float>(i * 20 + 15), 115.0f), instanced, 0.0f, 100 + i);
+		Config.instancedShapesEnabled = false;
+	}
+
+	std::vector<CapturedFrame> DrawFrames(bool merging, bool arena)
+	{
+		Config.batchMergingEnabled = merging;
+		Config.frameArenaEnabled   = arena;
+
+		std::vector<CapturedFrame> frames;
+		const Array<Index>*		   frameIndices = nullptr;
+		Drawer					   drawer;
+		drawer.GetCallbacks().uploadFrame = [&](const Array<Vertex>&, const Array<Index>& indices) { frameIndices = &indices; };
+		drawer.GetCallbacks().draw		  = [&](DrawBuffer* buf) {
+			   CapturedFrame& frame = frames.back();
+			   const int	  base	= static_cast<int>(frame.vertices.size());
+			   frame.vertices.insert(frame.vertices.end(), buf->vertexBuffer.m_data, buf->vertexBuffer.m_data + buf->vertexBuffer.m_size);
+
+			   for (int i = 0; i < buf->indexBuffer.m_size; i++)
+				   frame.indices.push_back(base + static_cast<int>(buf->indexBuffer[i]));
+
+			   // The arena range has to hold the same indices as the buffer itself.
+			   if (arena)
+			   {
+				   for (int i = 0; i < buf->indexCount; i++)
+					   frame.arenaIndices.push_back(base + static_cast<int>((*frameIndices)[buf->indexOffset + i]));
+			   }
+
+			   for (int i = 0; i < buf->instanceBuffer.m_size; i++)
+				   frame.instanceCenters.push_back(buf->instanceBuffer[i].center.x);
+
+			   frame.draws++;
+		};
+
+		for (int i = 0; i < FRAME_COUNT; i++)
+		{
+			frames.push_back(CapturedFrame());
+			DrawFrame(drawer, i);
+			drawer.FlushBuffers();
+			drawer.ResetFrame();
+		}
+
+		Config.batchMergingEnabled = false;
+		Config.frameArenaEnabled   = false;
+		return frames;
+	}
+
+	bool IsSameGeometry(const CapturedFrame& a, const CapturedFrame& b)
+	{
+		if (a.vertices.size() != b.vertices.size() || a.indices != b.indices || a.instanceCenters != b.instanceCenters)
+			return false;
+
+		return std::memcmp(a.vertices.data(), b.vertices.data(), a.vertices.size() * sizeof(Vertex)) == 0;
+	}
+} // namespace
+
+int main()
+{
+	const std::vector<CapturedFrame> expected = DrawFrames(false, false);
+
+	for (int arena = 0; arena < 2; arena++)
+	{
+		const std::vector<CapturedFrame> merged = DrawFrames(true, arena == 1);
+
+		for (int i = 0; i < FRAME_COUNT; i++)
+		{
+			// 4 runs of rects split by the texture change, 1 of instanced rects.
+			LINAVG_CHECK(merged[i].draws == 4);
+			LINAVG_CHECK(expected[i].draws == 50);
+			LINAVG_CHECK(arena == 0 || merged[i].arenaIndices == merged[i].indices);
+
+			if (!IsSameGeometry(expected[i], merged[i]))
+			{
+				g_testFailures++;
+				std::printf("Merged geometry differs from unmerged in frame %d%s\n", i, arena == 1 ? ", frame arena" : "");
+			}
+		}
+	}
+
+	return g_testFailures;
+}
@@ -0,0 +1,232 @@
+/*
+This file is a part of: LinaVG
+https://github.com/inanevin/LinaVG
+
+Author: Inan Evin
+http://www.inanevin.com
+
+The 2-Clause BSD License
+
+Copyright (c) [2022-] Inan Evin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+   1. Redistributions of source code must retain the above copyright notice, this
+	  list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright notice,
+	  this list of conditions and the following disclaimer in the documentation
+	  and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+// Hashes DrawLines output for every joint, cap, AA, outline & gradient variant, checking it stays byte identical to the recorded goldens.
+// Pass --print to list the hashes of the current build, e.g. to record them again after an intended change in output.
+
+#include "LinaVG/LinaVG.hpp"
+#include "LinaVG/Utility/Utility.hpp"
+#include "TestCommon.hpp"
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using namespace LinaVG;
+
+namespace
+{
+	const char* JOINT_NAMES[] = {"Miter", "Bevel", "BevelRound", "VtxAverage"};
+
+	// Recorded with Scalar kernels on x86-64, sin & cos of other math libraries might differ in the last bits.
+	// Index & vertex attributes are hashed as 32 bit values, so the index size doesn't matter but the vertex layout does.
+#if defined(LINAVG_VERTEX_COLOR_RGBA8) || defined(LINAVG_VERTEX_UV_HALF)
+	constexpr bool	   HAS_GOLDENS	   = false;
+	constexpr uint64_t JOINT_GOLDENS[] = {0, 0, 0, 0};
+	constexpr uint64_t SPLIT_GOLDEN	   = 0;
+#elif defined(LINAVG_VERTEX_EDGE_AA)
+	constexpr bool	   HAS_GOLDENS	   = true;
+	constexpr uint64_t JOINT_GOLDENS[] = {0x3815459136f4a18full, 0x8a13deefa5be08c4ull, 0x61d456219f888c92ull, 0xe074fcf8b0f96ce8ull};
+	constexpr uint64_t SPLIT_GOLDEN	   = 0x0398ab0997648bfcull;
+#else
+	constexpr bool	   HAS_GOLDENS	   = true;
+	constexpr uint64_t JOINT_GOLDENS[] = {0x3176963de32d6dbcull, 0x6240a07d36cedfbfull, 0xd36dc60bbe091399ull, 0x13edf58d9c2e874eull};
+	constexpr uint64_t SPLIT_GOLDEN	   = 0x0398ab0997648bfcull;
+#endif
+
+	// FNV-1a.
+	struct Hash
+	{
+		uint64_t value = 1469598103934665603ull;
+
+		void Add(const void* data, size_t size)
+		{
+			const unsigned char* bytes = static_cast<const unsigned char*>(data);
+			for (size_t i = 0; i < size; i++)
+			{
+				value ^= bytes[i];
+				value *= 1099511628211ull;
+			}
+		}
+
+		void Add(float f)
+		{
+			Add(&f, sizeof(float));
+		}
+
+		void Add(uint32_t u)
+		{
+			Add(&u, sizeof(uint32_t));
+		}
+	};
+
+	void HashBuffer(Hash& hash, DrawBuffer* buf, bool positionsOnly)
+	{
+		for (int i = 0; i < buf->vertexBuffer.m_size; i++)
+		{
+			const Vertex& v = buf->vertexBuffer[i];
+			hash.Add(v.pos.x);
+			hash.Add(v.pos.y);
+
+			if (positionsOnly)
+				continue;
+
+			const Vec2 uv  = static_cast<Vec2>(v.uv);
+			const Vec4 col = static_cast<Vec4>(v.col);
+			hash.Add(uv.x);
+			hash.Add(uv.y);
+			hash.Add(col.x);
+			hash.Add(col.y);
+			hash.Add(col.z);
+			hash.Add(col.w);
+#ifdef LINAVG_VERTEX_EDGE_AA
+			hash.Add(v.edge);
+#endif
+		}
+
+		if (positionsOnly)
+			return;
+
+		for (int i = 0; i < buf->indexBuffer.m_size; i++)
+			hash.Add(static_cast<uint32_t>(buf->indexBuffer[i]));
+
+		hash.Add(static_cast<uint32_t>(buf->shapeType));
+	}
+
+	// Sharp turns, a straight run & a reversal cover every joint path, including parallel & overlapping segments.
+	std::vector<Vec2> MakeZigZag()
+	{
+		std::vector<Vec2> points;
+
+		for (int i = 0; i < 24; i++)
+		{
+			const float angle = static_cast<float>(i) * 0.9f;
+			points.push_back(Vec2(40.0f + static_cast<float>(i) * 14.0f, 200.0f + std::sin(angle) * (20.0f + static_cast<float>(i % 5) * 15.0f)));
+		}
+
+		points.push_back(Vec2(points.back().x + 30.0f, points.back().y));
+		points.push_back(Vec2(points.back().x + 30.0f, points.back().y));
+		points.push_back(Vec2(points.back().x - 60.0f, points.back().y + 5.0f));
+		points.push_back(Vec2(points.back().x, points.back().y + 40.0f));
+		return points;
+	}
+
+	uint64_t HashJoint(Drawer& drawer, Hash& frameHash, LineJointType joint)
+	{
+		std::vector<Vec2> points = MakeZigZag();
+		Hash			  hash;
+
+		for (int cap = 0; cap < 4; cap++)
+		{
+			for (int aa = 0; aa < 2; aa++)
+			{
+				for (int outline = 0; outline < 2; outline++)
+				{
+					for (int gradient = 0; gradient < 3; gradient++)
+					{
+						StyleOptions style;
+						style.color					  = Vec4Grad(Vec4(1.0f, 0.2f, 0.1f, 1.0f), Vec4(0.1f, 0.3f, 1.0f, 0.8f));
+						style.color.gradientType	  = static_cast<GradientType>(gradient);
+						style.thickness				  = ThicknessGrad(3.0f, 11.0f);
+						style.rounding				  = 0.5f;
+						style.aaEnabled				  = aa == 1;
+						style.outlineOptions.thickness = outline == 1 ? 2.5f : 0.0f;
+						style.outlineOptions.color	  = Vec4Grad(Vec4(0.0f, 1.0f, 0.0f, 1.0f), Vec4(1.0f, 1.0f, 0.0f, 1.0f));
+
+						frameHash = Hash();
+						drawer.DrawLines(points.data(), static_cast<int>(points.size()), style, static_cast<LineCapDirection>(cap), joint, 1);
+						drawer.FlushBuffers();
+						drawer.ResetFrame();
+						hash.Add(&frameHash.value, sizeof(uint64_t));
+					}
+				}
+			}
+		}
+
+		return hash.value;
+	}
+
+	// Too many vertices for 16 bit indices, checks the halves meet at the seam the way a single stroke does.
+	uint64_t HashSplit(Drawer& drawer, Hash& frameHash)
+	{
+		std::vector<Vec2> points;
+		for (int i = 0; i < 20000; i++)
+			points.push_back(Vec2(static_cast<float>(i) * 0.3f, 500.0f + std::sin(static_cast<float>(i) * 0.5f) * 30.0f));
+
+		StyleOptions style;
+		style.thickness = ThicknessGrad(2.0f, 6.0f);
+
+		frameHash = Hash();
+		drawer.DrawLines(points.data(), static_cast<int>(points.size()), style, LineCapDirection::Both, LineJointType::Miter, 1);
+		drawer.FlushBuffers();
+		drawer.ResetFrame();
+		return frameHash.value;
+	}
+
+	void CheckGolden(const char* name, uint64_t hash, uint64_t golden, bool print)
+	{
+		if (print)
+			std::printf("%s: 0x%016llxull\n", name, static_cast<unsigned long long>(hash));
+
+		if (HAS_GOLDENS && hash != golden)
+		{
+			g_testFailures++;
+			std::printf("%s output changed, hash 0x%016llx instead of 0x%016llx\n", name, static_cast<unsigned long long>(hash), static_cast<unsigned long long>(golden));
+		}
+	}
+} // namespace
+
+int main(int argc, char** argv)
+{
+	const bool print = argc > 1 && std::strcmp(argv[1], "--print") == 0;
+
+	if (!HAS_GOLDENS)
+		std::printf("No goldens for this vertex layout, only printing hashes\n");
+
+	Utility::SetSIMDLevel(Utility::SIMDLevel::Scalar);
+
+	Hash   frameHash;
+	bool   positionsOnly = false;
+	Drawer drawer;
+	drawer.GetCallbacks().draw = [&](DrawBuffer* buf) { HashBuffer(frameHash, buf, positionsOnly); };
+
+	for (int i = 0; i < 4; i++)
+		CheckGolden(JOINT_NAMES[i], HashJoint(drawer, frameHash, static_cast<LineJointType>(i)), JOINT_GOLDENS[i], print || !HAS_GOLDENS);
+
+	// Split buffers differ in uvs, gradients & indices, the positions of both halves together have to match a single stroke.
+	positionsOnly = true;
+	CheckGolden("Split", HashSplit(drawer, frameHash), SPLIT_GOLDEN, print || !HAS_GOLDENS);
+
+	return g_testFailures;
+}
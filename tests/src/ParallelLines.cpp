@@ -0,0 +1,176 @@
+/*
+This file is a part of: LinaVG
+https://github.com/inanevin/LinaVG
+
+Author: Inan Evin
+http://www.inanevin.com
+
+The 2-Clause BSD License
+
+Copyright (c) [2022-] Inan Evin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+   1. Redistributions of source code must retain the above copyright notice, this
+	  list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright notice,
+	  this list of conditions and the following disclaimer in the documentation
+	  and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+// Draws long polylines with parallelLineThreshold 0 & above 0, checking the vertex & index buffers are byte identical.
+
+#include "LinaVG/LinaVG.hpp"
+#include "TestCommon.hpp"
+#include <cmath>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace LinaVG;
+
+namespace
+{
+	const char* JOINT_NAMES[] = {"Miter", "Bevel", "BevelRound", "VtxAverage"};
+
+	// Small chunks put many seams on sharp turns, uneven sizes leave a short last chunk.
+	constexpr int CHUNK_SIZES[] = {1, 7, 250, 4096};
+
+	struct CapturedBuffer
+	{
+		std::vector<Vertex> vertices;
+		std::vector<Index>	indices;
+	};
+
+	// Mostly smooth with sharp spikes & a straight run, so chunk entries see every joint path.
+	std::vector<Vec2> MakePolyline(int count)
+	{
+		std::vector<Vec2> points;
+		points.reserve(count);
+
+		for (int i = 0; i < count; i++)
+		{
+			const float x = static_cast<float>(i) * 0.25f;
+			float		y = 400.0f + std::sin(static_cast<float>(i) * 0.05f) * 120.0f;
+
+			if (i % 97 == 0)
+				y += 60.0f;
+			else if (i % 1000 > 900)
+				y = 400.0f;
+
+			points.push_back(Vec2(x, y));
+		}
+
+		return points;
+	}
+
+	std::vector<CapturedBuffer> Draw(const std::vector<Vec2>& points, const StyleOptions& opts, LineJointType joint)
+	{
+		std::vector<CapturedBuffer> captured;
+		Drawer						drawer;
+		drawer.GetCallbacks().draw = [&](DrawBuffer* buf) {
+			CapturedBuffer capture;
+			capture.vertices.assign(buf->vertexBuffer.m_data, buf->vertexBuffer.m_data + buf->vertexBuffer.m_size);
+			capture.indices.assign(buf->indexBuffer.m_data, buf->indexBuffer.m_data + buf->indexBuffer.m_size);
+			captured.push_back(capture);
+		};
+
+		StyleOptions style = opts;
+		drawer.DrawLines(const_cast<Vec2*>(points.data()), static_cast<int>(points.size()), style, LineCapDirection::Both, joint, 1);
+		drawer.FlushBuffers();
+		drawer.ResetFrame();
+		return captured;
+	}
+
+	bool IsSame(const std::vector<CapturedBuffer>& a, const std::vector<CapturedBuffer>& b)
+	{
+		if (a.size() != b.size())
+			return false;
+
+		for (size_t i = 0; i < a.size(); i++)
+		{
+			if (a[i].vertices.size() != b[i].vertices.size() || a[i].indices.size() != b[i].indices.size())
+				return false;
+
+			if (std::memcmp(a[i].vertices.data(), b[i].vertices.data(), a[i].vertices.size() * sizeof(Vertex)) != 0)
+				return false;
+
+			if (std::memcmp(a[i].indices.data(), b[i].indices.data(), a[i].indices.size() * sizeof(Index)) != 0)
+				return false;
+		}
+
+		return true;
+	}
+
+	void TestStyle(const std::vector<Vec2>& points, const StyleOptions& style, const char* styleName)
+	{
+		for (int joint = 0; joint < 4; joint++)
+		{
+			Config.parallelLineThreshold			= 0;
+			const std::vector<CapturedBuffer> serial = Draw(points, style, static_cast<LineJointType>(joint));
+
+			for (int chunkSize : CHUNK_SIZES)
+			{
+				Config.parallelLineThreshold = 2;
+				Config.lineChunkSize		 = chunkSize;
+
+				if (!IsSame(serial, Draw(points, style, static_cast<LineJointType>(joint))))
+				{
+					g_testFailures++;
+					std::printf("Parallel output differs from serial, %s, %s joints, chunk size %d\n", styleName, JOINT_NAMES[joint], chunkSize);
+				}
+			}
+		}
+	}
+} // namespace
+
+int main()
+{
+	// 20k points take more vertices than 16 bit indices allow, so the split halves are stroked in parallel too.
+	const std::vector<Vec2> points = MakePolyline(20000);
+
+	StyleOptions plain;
+	plain.thickness = ThicknessGrad(2.0f, 9.0f);
+	plain.rounding	= 0.5f;
+
+	StyleOptions						  decorated = plain;
+	decorated.color						= Vec4Grad(Vec4(1.0f, 0.0f, 0.0f, 1.0f), Vec4(0.0f, 0.0f, 1.0f, 1.0f));
+	decorated.aaEnabled					= true;
+	decorated.outlineOptions.thickness	= 2.0f;
+	decorated.outlineOptions.color		= Vec4(0.0f, 1.0f, 0.0f, 1.0f);
+
+	// The Drawer's own thread pool.
+	TestStyle(points, plain, "plain");
+	TestStyle(points, decorated, "AA & outline");
+
+	// A parallelFor running the tasks on fresh threads.
+	Config.parallelFor = [](int taskCount, const std::function<void(int taskIndex)>& task) {
+		std::vector<std::thread> threads;
+		for (int i = 0; i < taskCount; i++)
+			threads.emplace_back(task, i);
+
+		for (std::thread& thread : threads)
+			thread.join();
+	};
+
+	TestStyle(points, decorated, "AA & outline, parallelFor");
+
+	Config.parallelFor			 = nullptr;
+	Config.parallelLineThreshold = 0;
+	Config.lineChunkSize		 = 4096;
+	return g_testFailures;
+}
@@ -0,0 +1,145 @@
+/*
+This file is a part of: LinaVG
+https://github.com/inanevin/LinaVG
+
+Author: Inan Evin
+http://www.inanevin.com
+
+The 2-Clause BSD License
+
+Copyright (c) [2022-] Inan Evin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+   1. Redistributions of source code must retain the above copyright notice, this
+	  list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright notice,
+	  this list of conditions and the following disclaimer in the documentation
+	  and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+// Draws frames of cached shapes whose geometry, style, clip rect & curve tolerance change between frames, checking the output matches drawing them uncached.
+
+#include "LinaVG/LinaVG.hpp"
+#include "LinaVG/Core/Math.hpp"
+#include "TestCommon.hpp"
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+using namespace LinaVG;
+
+namespace
+{
+	constexpr int FRAME_COUNT = 9;
+
+	struct CapturedFrame
+	{
+		std::vector<Vertex> vertices;
+		std::vector<Index>	indices;
+		std::vector<int>	bufferSizes;
+	};
+
+	// Frames 0 & 1 are the same so the second one replays the cache, later frames change one more parameter each, the last one only the tolerance.
+	void DrawFrame(Drawer& drawer, int frame)
+	{
+		Config.flatnessTolerance = frame >= 8 ? 0.5f : 0.0f;
+
+		const float offset = frame >= 2 ? static_cast<float>(Math::Min(frame, 7)) * 3.0f : 0.0f;
+
+		StyleOptions rect;
+		rect.uniqueID  = 1;
+		rect.color	   = Vec4(1.0f, 0.5f, 0.0f, 1.0f);
+		rect.rounding  = frame >= 3 ? 0.4f : 0.0f;
+		rect.aaEnabled = frame >= 4;
+		drawer.DrawRect(Vec2(10.0f + offset, 10.0f), Vec2(90.0f, 60.0f), rect, 0.0f, 1);
+
+		// Two calls sharing a unique ID are told apart by their order, which swaps in frame 5.
+		StyleOptions circle;
+		circle.uniqueID					= 2;
+		circle.outlineOptions.thickness = frame >= 6 ? 2.0f : 0.0f;
+		const float firstRadius			= frame >= 5 ? 30.0f : 20.0f;
+		drawer.DrawCircle(Vec2(200.0f, 100.0f), firstRadius, circle, 24);
+		drawer.DrawCircle(Vec2(300.0f, 100.0f), 50.0f - firstRadius, circle, 24);
+
+		if (frame >= 7)
+			drawer.SetClipRect(Vec4i(0, 0, 150, 150));
+
+		StyleOptions line;
+		line.uniqueID  = 3;
+		line.thickness = 4.0f;
+		Vec2 points[]  = {Vec2(20.0f, 200.0f), Vec2(80.0f, 260.0f + offset), Vec2(140.0f, 210.0f), Vec2(200.0f, 280.0f)};
+		drawer.DrawLines(points, 4, line, LineCapDirection::Both, LineJointType::BevelRound, 2);
+		drawer.SetClipRect(Vec4i(0, 0, 0, 0));
+	}
+
+	std::vector<CapturedFrame> DrawFrames(bool caching, bool deferred)
+	{
+		Config.shapeCachingEnabled = caching;
+
+		std::vector<CapturedFrame> frames;
+		Drawer					   drawer;
+		drawer.SetDeferred(deferred);
+		drawer.GetCallbacks().draw = [&](DrawBuffer* buf) {
+			CapturedFrame& frame = frames.back();
+			frame.vertices.insert(frame.vertices.end(), buf->vertexBuffer.m_data, buf->vertexBuffer.m_data + buf->vertexBuffer.m_size);
+			frame.indices.insert(frame.indices.end(), buf->indexBuffer.m_data, buf->indexBuffer.m_data + buf->indexBuffer.m_size);
+			frame.bufferSizes.push_back(buf->vertexBuffer.m_size);
+		};
+
+		for (int i = 0; i < FRAME_COUNT; i++)
+		{
+			frames.push_back(CapturedFrame());
+			DrawFrame(drawer, i);
+			drawer.FlushBuffers();
+			drawer.ResetFrame();
+		}
+
+		Config.shapeCachingEnabled = false;
+		Config.flatnessTolerance   = 0.0f;
+		return frames;
+	}
+
+	bool IsSame(const CapturedFrame& a, const CapturedFrame& b)
+	{
+		if (a.vertices.size() != b.vertices.size() || a.indices.size() != b.indices.size() || a.bufferSizes != b.bufferSizes)
+			return false;
+
+		return std::memcmp(a.vertices.data(), b.vertices.data(), a.vertices.size() * sizeof(Vertex)) == 0 && std::memcmp(a.indices.data(), b.indices.data(), a.indices.size() * sizeof(Index)) == 0;
+	}
+} // namespace
+
+int main()
+{
+	const std::vector<CapturedFrame> expected = DrawFrames(false, false);
+
+	for (int deferred = 0; deferred < 2; deferred++)
+	{
+		const std::vector<CapturedFrame> cached = DrawFrames(true, deferred == 1);
+
+		for (int i = 0; i < FRAME_COUNT; i++)
+		{
+			if (!IsSame(expected[i], cached[i]))
+			{
+				g_testFailures++;
+				std::printf("Cached output differs from uncached in frame %d%s\n", i, deferred == 1 ? ", deferred" : "");
+			}
+		}
+	}
+
+	return g_testFailures;
+}
@@ -0,0 +1,170 @@
+/*
+This file is a part of: LinaVG
+https://github.com/inanevin/LinaVG
+
+Author: Inan Evin
+http://www.inanevin.com
+
+The 2-Clause BSD License
+
+Copyright (c) [2022-] Inan Evin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+   1. Redistributions of source code must retain the above copyright notice, this
+	  list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright notice,
+	  this list of conditions and the following disclaimer in the documentation
+	  and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+// Runs the vertex kernels at every SIMD level the build & CPU support, comparing against Scalar on random buffers.
+
+#include "LinaVG/LinaVG.hpp"
+#include "LinaVG/Utility/Utility.hpp"
+#include "TestCommon.hpp"
+#include <cmath>
+#include <random>
+
+using namespace LinaVG;
+
+namespace
+{
+	// Odd sizes leave remainders for the scalar tails of the vectorized loops.
+	constexpr int BUFFER_SIZES[] = {0, 1, 3, 4, 7, 8, 9, 31, 1000, 4099};
+
+	const char* LEVEL_NAMES[] = {"Scalar", "SSE2", "AVX2", "NEON"};
+
+	bool IsNear(float a, float b)
+	{
+		return std::fabs(a - b) <= 1e-4f * std::fmax(1.0f, std::fabs(a));
+	}
+
+	bool IsSameVertex(const Vertex& a, const Vertex& b)
+	{
+		const Vec4 colA = static_cast<Vec4>(a.col);
+		const Vec4 colB = static_cast<Vec4>(b.col);
+		return IsNear(a.pos.x, b.pos.x) && IsNear(a.pos.y, b.pos.y) && IsNear(static_cast<float>(a.uv.x), static_cast<float>(b.uv.x)) && IsNear(static_cast<float>(a.uv.y), static_cast<float>(b.uv.y)) && IsNear(colA.x, colB.x) && IsNear(colA.y, colB.y) &&
+			   IsNear(colA.z, colB.z) && IsNear(colA.w, colB.w);
+	}
+
+	bool IsSameBuffer(const Array<Vertex>& a, const Array<Vertex>& b)
+	{
+		for (int i = 0; i < a.m_size; i++)
+		{
+			if (!IsSameVertex(a[i], b[i]))
+				return false;
+		}
+
+		return true;
+	}
+
+	void FillRandom(Array<Vertex>& vertices, int count, std::mt19937& rng)
+	{
+		std::uniform_real_distribution<float> pos(-1000.0f, 1000.0f);
+		std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+		vertices.resize(count);
+
+		for (int i = 0; i < count; i++)
+		{
+			Vertex& v = vertices[i];
+			v		  = Vertex();
+			v.pos	  = Vec2(pos(rng), pos(rng));
+			v.uv	  = Vec2(unit(rng), unit(rng));
+			v.col	  = Vec4(unit(rng), unit(rng), unit(rng), unit(rng));
+		}
+	}
+
+	// Runs a kernel on a copy of the source at Scalar & at the given level, checking both copies match.
+	template <typename Kernel> void CompareKernel(const Array<Vertex>& source, Utility::SIMDLevel level, const char* kernelName, Kernel kernel)
+	{
+		Array<Vertex> expected(source);
+		Array<Vertex> actual(source);
+
+		Utility::SetSIMDLevel(Utility::SIMDLevel::Scalar);
+		kernel(expected.m_data, expected.m_size);
+		Utility::SetSIMDLevel(level);
+		kernel(actual.m_data, actual.m_size);
+
+		if (!IsSameBuffer(expected, actual))
+		{
+			g_testFailures++;
+			std::printf("%s differs from Scalar at %s with %d vertices\n", kernelName, LEVEL_NAMES[static_cast<int>(level)], source.m_size);
+		}
+	}
+
+	void TestLevel(Utility::SIMDLevel level)
+	{
+		std::mt19937  rng(1234);
+		Array<Vertex> source;
+
+		const Vec2 bbMin = Vec2(-900.0f, -800.0f);
+		const Vec2 bbMax = Vec2(700.0f, 950.0f);
+
+		for (int count : BUFFER_SIZES)
+		{
+			FillRandom(source, count, rng);
+
+			CompareKernel(source, level, "RotateVertices", [](Vertex* v, int n) { Utility::RotateVertices(v, n, Vec2(12.5f, -40.0f), 37.0f); });
+			CompareKernel(source, level, "CalculateVertexUVs", [&](Vertex* v, int n) { Utility::CalculateVertexUVs(v, n, bbMin, bbMax); });
+
+			for (int type = 0; type < 3; type++)
+			{
+				Vec4Grad color		= Vec4Grad(Vec4(1.0f, 0.2f, 0.3f, 0.9f), Vec4(0.1f, 0.8f, 0.5f, 0.4f));
+				color.gradientType	= static_cast<GradientType>(type);
+				const bool preserve = type == 1;
+
+				CompareKernel(source, level, "CalculateVertexColors", [&](Vertex* v, int n) { Utility::CalculateVertexColors(v, n, color, preserve); });
+				CompareKernel(source, level, "CalculateVertexUVsAndColors", [&](Vertex* v, int n) { Utility::CalculateVertexUVsAndColors(v, n, bbMin, bbMax, color, preserve); });
+			}
+
+			Vec2 expectedMin, expectedMax, actualMin, actualMax;
+			Utility::SetSIMDLevel(Utility::SIMDLevel::Scalar);
+			Utility::GetVerticesBoundingBox(source.m_data, source.m_size, expectedMin, expectedMax);
+			Utility::SetSIMDLevel(level);
+			Utility::GetVerticesBoundingBox(source.m_data, source.m_size, actualMin, actualMax);
+
+			LINAVG_CHECK(expectedMin.x == actualMin.x && expectedMin.y == actualMin.y);
+			LINAVG_CHECK(expectedMax.x == actualMax.x && expectedMax.y == actualMax.y);
+		}
+	}
+} // namespace
+
+int main()
+{
+	const Utility::SIMDLevel detected = Utility::GetSIMDLevel();
+
+	for (int i = static_cast<int>(Utility::SIMDLevel::SSE2); i <= static_cast<int>(Utility::SIMDLevel::NEON); i++)
+	{
+		const Utility::SIMDLevel level = static_cast<Utility::SIMDLevel>(i);
+
+		// Unsupported levels reset to the detected one.
+		Utility::SetSIMDLevel(level);
+		if (Utility::GetSIMDLevel() != level)
+		{
+			std::printf("%s: not supported, skipped\n", LEVEL_NAMES[i]);
+			continue;
+		}
+
+		TestLevel(level);
+		std::printf("%s: tested\n", LEVEL_NAMES[i]);
+	}
+
+	Utility::SetSIMDLevel(detected);
+	return g_testFailures;
+}